@@ -52,6 +52,44 @@ T *aligned_alloc_T(size_t N, size_t alignment = alignof(T))
     return static_cast<T*>(aligned_alloc_raw(N * sizeof(T), alignment));
 }
 
+/// @brief Per-thread scratch memory, grown as needed and kept until the thread exits
+///
+/// Plans are shared between FFT objects and threads, so a transform can't keep its temporary
+/// data in the plan. Each Tag has a separate buffer - a plan can run another plan which uses
+/// scratch memory of its own.
+template <class Tag>
+class ThreadScratch
+{
+public:
+    /// @brief Returns a 32-byte aligned buffer of at least N elements of type T;
+    ///        the contents are not preserved between calls
+    template <class T>
+    static T *get(size_t N)
+    {
+        thread_local ThreadScratch buffer;
+        return static_cast<T*>(buffer.reserve(N * sizeof(T)));
+    }
+
+    ~ThreadScratch() { free(data); }
+
+private:
+    ThreadScratch() = default;
+
+    void *reserve(size_t bytes)
+    {
+        if (bytes > capacity)
+        {
+            free(data);
+            data = aligned_alloc_raw(bytes, 32);
+            capacity = bytes;
+        }
+        return data;
+    }
+
+    void *data = nullptr;
+    size_t capacity = 0;
+};
+
 } // genfft
 
 #endif // GEN_FFT_ALLOC_H
@@ -44,8 +44,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
     namespace genfft {
     namespace backend {
         using impl_x86_dispatch::GetImpl;
+        using impl_x86_dispatch::GetTunedImpl;
+        using impl_x86_dispatch::GetStockhamImpl;
         using impl_x86_dispatch::GetVertImpl;
         using impl_x86_dispatch::GetDITImpl;
+        using impl_x86_dispatch::GetDIFImpl;
+        using impl_x86_dispatch::GetPointwiseImpl;
     } // backend
     } // genfft
     #else
@@ -53,8 +57,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
     namespace genfft {
     namespace backend {
         using impl_native::GetImpl;
+        using impl_native::GetTunedImpl;
+        using impl_native::GetStockhamImpl;
         using impl_native::GetVertImpl;
         using impl_native::GetDITImpl;
+        using impl_native::GetDIFImpl;
+        using impl_native::GetPointwiseImpl;
     } // backend
     } // genfft
     #endif
@@ -63,8 +71,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
     namespace genfft {
     namespace backend {
         using impl_generic::GetImpl;
+        using impl_generic::GetTunedImpl;
+        using impl_generic::GetStockhamImpl;
         using impl_generic::GetVertImpl;
         using impl_generic::GetDITImpl;
+        using impl_generic::GetDIFImpl;
+        using impl_generic::GetPointwiseImpl;
     } // backend
     } // genfft
 #endif
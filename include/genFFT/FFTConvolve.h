@@ -0,0 +1,582 @@
+/*
+Copyright 2026 Michal Zientkiewicz
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef GENFFT_CONVOLVE_H
+#define GENFFT_CONVOLVE_H
+
+#include "fft.h"
+#include <algorithm>
+#include <cmath>
+
+namespace genfft {
+
+namespace impl {
+
+template <class E>
+struct convolution_scalar { using type = E; };
+template <class T>
+struct convolution_scalar<std::complex<T>> { using type = T; };
+
+template <class T>
+inline T convolution_conj(T x) { return x; }
+template <class T>
+inline std::complex<T> convolution_conj(std::complex<T> x) { return conj(x); }
+
+/// @brief Forward and inverse transforms of the convolution engines
+///
+/// The spectra are only ever multiplied pointwise, so their order doesn't matter as long
+/// as the signal and the kernel use the same transforms. Complex power-of-two transforms
+/// use a decimation-in-frequency forward transform and a DIT inverse, which together never
+/// reorder the data; other sizes use the FFT with reordering.
+template <class E>
+class ConvolutionTransform;
+
+template <class T>
+class ConvolutionTransform<std::complex<T>>
+{
+public:
+    ConvolutionTransform() = default;
+    explicit ConvolutionTransform(int n) : n(n), fft(n)
+    {
+        if ((n & (n-1)) == 0)
+            dif = FFTDIF<T>(n);
+        // plans create their implementation on first use - do it here rather than in the engines
+        std::vector<std::complex<T>> x(n), spectrum(n);
+        forward(spectrum.data(), x.data());
+        inverse(x.data(), spectrum.data());
+    }
+
+    /// @brief Number of complex values in a spectrum
+    int spectrum_size() const noexcept { return n; }
+
+    /// @brief Computes the spectrum of n values of x; spectrum must not be equal to x
+    void forward(std::complex<T> *spectrum, const std::complex<T> *x)
+    {
+        if (dif)
+        {
+            std::copy(x, x + n, spectrum);
+            dif.template transform<false>(spectrum);
+        }
+        else
+        {
+            fft.template transform<false>(spectrum, x);
+        }
+    }
+
+    /// @brief Computes n values of x from a spectrum, which is overwritten; the result isn't normalized
+    void inverse(std::complex<T> *x, std::complex<T> *spectrum)
+    {
+        if (dif)
+        {
+            fft.template transform_no_scramble<true>(spectrum);
+            std::copy(spectrum, spectrum + n, x);
+        }
+        else
+        {
+            fft.template transform<true>(x, spectrum);
+        }
+    }
+
+    explicit operator bool() const noexcept { return static_cast<bool>(fft); }
+
+private:
+    int n = 0;
+    FFT<T> fft;
+    FFTDIF<T> dif;
+};
+
+/// @brief Transforms of real signals: RealFFT with n/2+1-point spectra, for sizes that it supports
+template <class T>
+class ConvolutionTransform
+{
+public:
+    ConvolutionTransform() = default;
+    explicit ConvolutionTransform(int n) : n(n)
+    {
+        if (n % 4 == 0 || n <= 2)
+        {
+            rfft = RealFFT<T>(n);
+            std::vector<T> x(n);
+            std::vector<std::complex<T>> spectrum(n/2+1);
+            forward(spectrum.data(), x.data());
+            inverse(x.data(), spectrum.data());
+        }
+        else
+        {
+            promoted = ConvolutionTransform<std::complex<T>>(n);
+            temp.resize(n);
+        }
+    }
+
+    /// @brief Number of complex values in a spectrum
+    int spectrum_size() const noexcept { return promoted ? n : n/2+1; }
+
+    /// @brief Computes the spectrum of n values of x
+    void forward(std::complex<T> *spectrum, const T *x)
+    {
+        if (promoted)
+        {
+            std::copy(x, x + n, temp.data());
+            promoted.forward(spectrum, temp.data());
+        }
+        else
+        {
+            rfft.forward(spectrum, x, true);
+        }
+    }
+
+    /// @brief Computes n values of x from a spectrum, which is overwritten; the result isn't normalized
+    void inverse(T *x, std::complex<T> *spectrum)
+    {
+        if (promoted)
+        {
+            promoted.inverse(temp.data(), spectrum);
+            for (int i = 0; i < n; i++)
+                x[i] = temp[i].real();
+        }
+        else
+        {
+            rfft.inverse(x, spectrum);
+        }
+    }
+
+    explicit operator bool() const noexcept { return n > 0; }
+
+private:
+    int n = 0;
+    RealFFT<T> rfft;
+    /// @brief Complex transforms, used for sizes that RealFFT doesn't support
+    ConvolutionTransform<std::complex<T>> promoted;
+    std::vector<std::complex<T>> temp;
+};
+
+} // impl
+
+///@brief Fast 1D convolution or correlation of signals with a fixed kernel
+///
+///The plans, the workspace and the spectrum of the kernel are owned by the object;
+///the spectrum is computed once, by set_kernel or set_correlation_kernel, and reused
+///by every call to apply. The 1/N normalization of the inverse transform is folded
+///into the cached spectrum, so applying the kernel is a single pointwise multiplication.
+///Real signals are transformed with RealFFT and only the n/2+1 nonredundant frequencies
+///are multiplied; complex power-of-two transforms (all linear convolutions) use
+///a decimation-in-frequency forward transform and a DIT inverse, which together never
+///reorder the data.
+///@tparam E element type: float, double, std::complex<float> or std::complex<double>
+template <class E>
+class Convolver
+{
+public:
+    using T = typename impl::convolution_scalar<E>::type;
+
+    Convolver() = default;
+
+    ///@param signal_len length of the signals passed to apply
+    ///@param kernel_len length of the kernel; in circular mode it must not exceed signal_len
+    ///@param mode       linear (zero-padded) or circular convolution
+    Convolver(int signal_len, int kernel_len, ConvolutionMode mode = ConvolutionMode::Linear)
+    : mode(mode), signal_len(signal_len), kernel_len(kernel_len)
+    {
+        assert(signal_len > 0 && kernel_len > 0);
+        if (mode == ConvolutionMode::Circular)
+        {
+            assert(kernel_len <= signal_len && "kernel longer than the period of a circular convolution");
+            n = out_len = signal_len;
+        }
+        else
+        {
+            out_len = signal_len + kernel_len - 1;
+            n = 1;
+            while (n < out_len)
+                n <<= 1;
+        }
+        transform = impl::ConvolutionTransform<E>(n);
+        pointwise = backend::GetPointwiseImpl(T());
+        spectrum.resize(transform.spectrum_size());
+        work.resize(transform.spectrum_size());
+        padded.resize(n);
+    }
+
+    ///@brief Sets the kernel for convolution: out[j] = sum signal[i] * kernel[j-i]
+    ///@param kernel kernel_size() elements
+    void set_kernel(const E *kernel)
+    {
+        load_kernel(kernel, false);
+    }
+
+    ///@brief Sets the kernel for correlation: out[j] = sum signal[i+j-(kernel_size()-1)] * conj(kernel[i])
+    ///       in linear mode, or out[j] = sum signal[(i+j) mod signal_size()] * conj(kernel[i]) in circular mode
+    ///@param kernel kernel_size() elements
+    void set_correlation_kernel(const E *kernel)
+    {
+        load_kernel(kernel, true);
+    }
+
+    ///@brief Convolves (or correlates) a signal with the current kernel
+    ///@param out    output_size() elements; may be equal to signal
+    ///@param signal signal_size() elements
+    void apply(E *out, const E *signal)
+    {
+        std::copy(signal, signal + signal_len, padded.data());
+        std::fill(padded.begin() + signal_len, padded.end(), E());
+        transform.forward(work.data(), padded.data());
+        pointwise->multiply((T*)work.data(), (const T*)spectrum.data(), transform.spectrum_size());
+        transform.inverse(padded.data(), work.data());
+        std::copy(padded.data(), padded.data() + out_len, out);
+    }
+
+    ///@brief Sets the kernel and convolves the signal with it
+    void convolve(E *out, const E *signal, const E *kernel)
+    {
+        set_kernel(kernel);
+        apply(out, signal);
+    }
+
+    ///@brief Sets the correlation kernel and correlates the signal with it
+    void correlate(E *out, const E *signal, const E *kernel)
+    {
+        set_correlation_kernel(kernel);
+        apply(out, signal);
+    }
+
+    int signal_size() const noexcept { return signal_len; }
+    int kernel_size() const noexcept { return kernel_len; }
+    int output_size() const noexcept { return out_len; }
+    ///@brief Size of the transforms used
+    int transform_size() const noexcept { return n; }
+    explicit operator bool() const noexcept { return static_cast<bool>(transform); }
+
+private:
+    void load_kernel(const E *kernel, bool correlation)
+    {
+        // the padded kernel is built in the workspace and transformed into the spectrum
+        E *h = padded.data();
+        std::fill(padded.begin(), padded.end(), E());
+        const T scale = T(1) / n;
+        for (int i = 0; i < kernel_len; i++)
+        {
+            E x = kernel[i] * scale;
+            if (!correlation)
+                h[i] = x;
+            else if (mode == ConvolutionMode::Linear)
+                h[kernel_len-1-i] = impl::convolution_conj(x);
+            else
+                h[i ? n-i : 0] = impl::convolution_conj(x);
+        }
+        transform.forward(spectrum.data(), h);
+    }
+
+    ConvolutionMode mode = ConvolutionMode::Linear;
+    int signal_len = 0, kernel_len = 0, out_len = 0, n = 0;
+    impl::ConvolutionTransform<E> transform;
+    FFTPointwiseImplPtr<T> pointwise;
+    std::vector<std::complex<T>> spectrum, work;
+    std::vector<E> padded;
+};
+
+///@brief Streaming FIR filter - overlap-save fast convolution of a continuous signal
+///
+///The input is cut into blocks of block_size() samples; each block is transformed together
+///with the last taps-1 samples before it, multiplied by the cached spectrum of the filter
+///and transformed back, and the part of the result not affected by circular wrap-around
+///is the filtered block. The transform size is chosen to minimize the cost per sample.
+///
+///process accepts chunks of any size and returns as many samples as it is given, delayed by
+///block_size() samples. Real signals are transformed with RealFFT.
+///All the memory is allocated up front: process never allocates. (The four-step FFT, used for
+///the largest transforms, keeps its scratch memory per thread; it is allocated when the filter
+///is created, and by the first block processed on any other thread.)
+///@tparam E element type: float, double, std::complex<float> or std::complex<double>
+template <class E>
+class FIRFilter
+{
+public:
+    using T = typename impl::convolution_scalar<E>::type;
+
+    FIRFilter() = default;
+
+    ///@param taps       filter coefficients (impulse response)
+    ///@param num_taps   number of coefficients
+    ///@param block_size number of samples filtered at a time; the transform size is
+    ///                  the power of two block_size + num_taps - 1 is rounded up to.
+    ///                  0 selects the transform size with the lowest cost per sample.
+    FIRFilter(const E *taps, int num_taps, int block_size = 0) : num_taps(num_taps)
+    {
+        assert(num_taps > 0 && block_size >= 0);
+        if (block_size)
+        {
+            n = 1;
+            while (n < block_size + num_taps - 1)
+                n <<= 1;
+        }
+        else
+        {
+            n = optimal_transform_size(num_taps);
+        }
+        block = n - (num_taps - 1);
+
+        transform = impl::ConvolutionTransform<E>(n);
+        pointwise = backend::GetPointwiseImpl(T());
+        spectrum.resize(transform.spectrum_size());
+        work.resize(transform.spectrum_size());
+        input.resize(n);
+        result.resize(n);
+
+        set_taps(taps);
+        reset();
+    }
+
+    ///@brief Replaces the filter coefficients; the number of taps doesn't change
+    void set_taps(const E *taps)
+    {
+        // the padded taps are built in the workspace, which has room for n elements
+        E *h = reinterpret_cast<E *>(work.data());
+        std::fill(h, h + n, E());
+        const T scale = T(1) / n;
+        for (int i = 0; i < num_taps; i++)
+            h[i] = taps[i] * scale;
+        transform.forward(spectrum.data(), h);
+    }
+
+    ///@brief Clears the history of the signal, as if the filter had only seen zeros
+    void reset()
+    {
+        std::fill(input.begin(), input.end(), E());
+        std::fill(result.begin(), result.end(), E());
+        fill = 0;
+    }
+
+    ///@brief Filters a chunk of the signal
+    ///@param out   count filtered samples, delayed by block_size(); may be equal to in
+    ///@param in    count input samples
+    ///@param count chunk size, arbitrary
+    void process(E *out, const E *in, int count)
+    {
+        E *pending = input.data() + num_taps - 1;
+        // the first num_taps-1 results are wrapped around - skip them
+        const E *output = result.data() + num_taps - 1;
+        while (count > 0)
+        {
+            int k = block - fill < count ? block - fill : count;
+            for (int i = 0; i < k; i++)
+                pending[fill + i] = in[i];
+            for (int i = 0; i < k; i++)
+                out[i] = output[fill + i];
+            fill += k;
+            in += k;
+            out += k;
+            count -= k;
+            if (fill == block)
+            {
+                filter_block();
+                fill = 0;
+            }
+        }
+    }
+
+    int taps() const noexcept { return num_taps; }
+    ///@brief Number of samples filtered at a time; also the delay of the output
+    int block_size() const noexcept { return block; }
+    int latency() const noexcept { return block; }
+    ///@brief Size of the transforms used
+    int transform_size() const noexcept { return n; }
+    explicit operator bool() const noexcept { return static_cast<bool>(transform); }
+
+    ///@brief Power-of-two transform size with the lowest estimated cost per output sample
+    static int optimal_transform_size(int num_taps)
+    {
+        // Cost of a block: two transforms (n log2 n each) and the pointwise work;
+        // only n - (num_taps - 1) outputs are valid. Small transforms aren't worth the overhead.
+        int best = 0;
+        double best_cost = 0;
+        int n = 64;
+        while (n < 2*num_taps)
+            n <<= 1;
+        for (; n <= (1 << 24); n <<= 1)
+        {
+            double lg = std::log2((double)n);
+            double cost = n * (2*lg + 3) / (n - num_taps + 1);
+            if (!best || cost < best_cost)
+            {
+                best = n;
+                best_cost = cost;
+            }
+        }
+        return best;
+    }
+
+private:
+    void filter_block()
+    {
+        transform.forward(work.data(), input.data());
+        pointwise->multiply((T*)work.data(), (const T*)spectrum.data(), transform.spectrum_size());
+        transform.inverse(result.data(), work.data());
+        // keep the last num_taps-1 input samples as the history of the next block
+        std::copy(input.end() - (num_taps - 1), input.end(), input.begin());
+    }
+
+    int num_taps = 0, n = 0, block = 0, fill = 0;
+    impl::ConvolutionTransform<E> transform;
+    FFTPointwiseImplPtr<T> pointwise;
+    std::vector<std::complex<T>> spectrum, work;
+    std::vector<E> input, result;
+};
+
+///@brief Uniformly partitioned convolution with a long impulse response, for real-time use
+///
+///The impulse response is split into partitions of block_size() samples, whose spectra
+///(transforms of 2*block_size() points) are computed up front. Each block of input is
+///transformed once, together with the previous block, and stored in a frequency-domain
+///delay line; the output block is the inverse transform of the sum of the last partitions()
+///input spectra, each multiplied by the spectrum of the partition of matching delay.
+///
+///The latency is one block and every block costs the same - two small transforms and
+///partitions() pointwise multiply-adds - regardless of how the input is chunked. Real signals
+///are transformed with RealFFT, so the spectra have only block_size()+1 frequencies.
+///All the memory is allocated up front; process takes no locks and never allocates.
+///@tparam E element type: float, double, std::complex<float> or std::complex<double>
+template <class E>
+class PartitionedConvolver
+{
+public:
+    using T = typename impl::convolution_scalar<E>::type;
+
+    PartitionedConvolver() = default;
+
+    ///@param ir         impulse response
+    ///@param ir_len     length of the impulse response
+    ///@param block_size partition size and latency, a power of two
+    PartitionedConvolver(const E *ir, int ir_len, int block_size = 64)
+    : ir_len(ir_len), block(block_size), n(2*block_size)
+    {
+        assert(ir_len > 0);
+        assert(block_size > 0 && (block_size & (block_size-1)) == 0 && "block size must be a power of two");
+        parts = (ir_len + block - 1) / block;
+
+        transform = impl::ConvolutionTransform<E>(n);
+        spectrum_size = transform.spectrum_size();
+        pointwise = backend::GetPointwiseImpl(T());
+        filter.resize((size_t)parts * spectrum_size);
+        delay_line.resize((size_t)parts * spectrum_size);
+        acc.resize(spectrum_size);
+        input.resize(n);
+        result.resize(n);
+
+        set_impulse_response(ir);
+        reset();
+    }
+
+    ///@brief Replaces the impulse response; its length doesn't change
+    void set_impulse_response(const E *ir)
+    {
+        // the padded partitions are built in the accumulator, which has room for n elements
+        E *h = reinterpret_cast<E *>(acc.data());
+        const T scale = T(1) / n;
+        for (int p = 0; p < parts; p++)
+        {
+            std::fill(h, h + n, E());
+            for (int i = 0; i < block && p*block + i < ir_len; i++)
+                h[i] = ir[p*block + i] * scale;
+            transform.forward(&filter[(size_t)p * spectrum_size], h);
+        }
+    }
+
+    ///@brief Clears the history of the signal, as if the convolver had only seen zeros
+    void reset()
+    {
+        std::fill(delay_line.begin(), delay_line.end(), std::complex<T>());
+        std::fill(input.begin(), input.end(), E());
+        std::fill(result.begin(), result.end(), E());
+        head = 0;
+        fill = 0;
+    }
+
+    ///@brief Convolves a chunk of the signal
+    ///@param out   count output samples, delayed by block_size(); may be equal to in
+    ///@param in    count input samples
+    ///@param count chunk size, arbitrary
+    void process(E *out, const E *in, int count)
+    {
+        E *pending = input.data() + block;
+        // the first half of the result is wrapped around - skip it
+        const E *output = result.data() + block;
+        while (count > 0)
+        {
+            int k = block - fill < count ? block - fill : count;
+            for (int i = 0; i < k; i++)
+                pending[fill + i] = in[i];
+            for (int i = 0; i < k; i++)
+                out[i] = output[fill + i];
+            fill += k;
+            in += k;
+            out += k;
+            count -= k;
+            if (fill == block)
+            {
+                convolve_block();
+                fill = 0;
+            }
+        }
+    }
+
+    int impulse_response_size() const noexcept { return ir_len; }
+    int block_size() const noexcept { return block; }
+    int latency() const noexcept { return block; }
+    int partitions() const noexcept { return parts; }
+    explicit operator bool() const noexcept { return static_cast<bool>(transform); }
+
+private:
+    void convolve_block()
+    {
+        // the delay line is a ring of spectra; the newest one goes in front of the previous head
+        head = head ? head - 1 : parts - 1;
+        std::complex<T> *x = &delay_line[(size_t)head * spectrum_size];
+        transform.forward(x, input.data());
+
+        std::copy(x, x + spectrum_size, acc.data());
+        pointwise->multiply((T*)acc.data(), (const T*)filter.data(), spectrum_size);
+        for (int p = 1, slot = head + 1; p < parts; p++, slot++)
+        {
+            if (slot == parts)
+                slot = 0;
+            pointwise->multiply_add((T*)acc.data(), (const T*)&delay_line[(size_t)slot * spectrum_size],
+                                    (const T*)&filter[(size_t)p * spectrum_size], spectrum_size);
+        }
+        transform.inverse(result.data(), acc.data());
+
+        std::copy(input.begin() + block, input.end(), input.begin());
+    }
+
+    int ir_len = 0, block = 0, n = 0, spectrum_size = 0, parts = 0, head = 0, fill = 0;
+    impl::ConvolutionTransform<E> transform;
+    FFTPointwiseImplPtr<T> pointwise;
+    std::vector<std::complex<T>> filter, delay_line, acc;
+    std::vector<E> input, result;
+};
+
+} // genfft
+
+#endif /* GENFFT_CONVOLVE_H */
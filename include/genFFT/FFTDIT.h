@@ -33,6 +33,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "FFTUtil.h"
 #include "FFTAlloc.h"
+#include "FFTRegistry.h"
 
 #include <memory>
 
@@ -45,6 +46,10 @@ struct FFTDITBase {
     virtual ~FFTDITBase()=default;
 
     virtual void apply(T *out, const T *in, bool half) const noexcept=0;
+    /// @brief Inverse of apply: turns N/2+1 values of a real signal's spectrum into the
+    ///        spectrum of the N/2-point complex signal of its interleaved even and odd samples
+    ///        (scaled by 2, as the inverse transforms are not normalized)
+    virtual void apply_inverse(T *out, const T *in) const noexcept=0;
     //virtual void apply(T *out, stride_t out_stride, const T *in, stride_t in_stride, index_t cols, bool half) const noexcept=0;
 };
 
@@ -31,14 +31,35 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define FFT_OPENMP_SIMD
 #endif
 
+#ifndef GENFFT_MAX_STATIC_LOG2
+/// @brief log2 of the largest size with a compile-time unrolled implementation.
+///        Larger transforms loop over runtime-sized levels on top of it,
+///        which reduces the code size at some cost in speed.
+#define GENFFT_MAX_STATIC_LOG2 23
+#endif
+
 #include "FFTUtil.h"
 #include "FFTAlloc.h"
+#include "FFTRegistry.h"
 
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 namespace genfft {
 namespace impl {
 
+static_assert(GENFFT_MAX_STATIC_LOG2 >= 4 && GENFFT_MAX_STATIC_LOG2 <= 23,
+              "GENFFT_MAX_STATIC_LOG2 must be between 4 and 23");
+
+/// @brief log2 of the compile-time level used for a 2^log2n transform; see GENFFT_MAX_STATIC_LOG2
+constexpr int static_log2(int log2n)
+{
+    return log2n < GENFFT_MAX_STATIC_LOG2 ? log2n : GENFFT_MAX_STATIC_LOG2;
+}
+
 // Single-row FFT
 template <class T>
 struct FFTBase
@@ -56,10 +77,138 @@ struct FFTBase
 
     virtual void forward(T *)=0;
     virtual void inverse(T *)=0;
+
+    template <bool inv>
+    inline void transform(T *out, const T *in)
+    {
+        if (inv)
+            inverse(out, in);
+        else
+            forward(out, in);
+    }
+
+    /// @brief Out-of-place transform of naturally ordered input; out must not alias in.
+    ///        The default implementation reorders the input and calls the in-place transform.
+    virtual void forward(T *out, const T *in)
+    {
+        scramble((complex<T>*)out, (const complex<T>*)in, size(), input_order());
+        forward(out);
+    }
+
+    /// @brief Out-of-place inverse transform of naturally ordered input; out must not alias in.
+    virtual void inverse(T *out, const T *in)
+    {
+        scramble((complex<T>*)out, (const complex<T>*)in, size(), input_order());
+        inverse(out);
+    }
+
+    template <bool inv>
+    inline void transform_inplace(T *data)
+    {
+        if (inv)
+            inverse_inplace(data);
+        else
+            forward_inplace(data);
+    }
+
+    /// @brief In-place transform of naturally ordered data.
+    ///        The default implementation bit-reverses the data in place and calls the in-place
+    ///        transform; other input orders go through a temporary copy.
+    virtual void forward_inplace(T *data)
+    {
+        if (reorder_inplace(data))
+            forward(data);
+        else
+            forward(data, std::vector<T>(data, data + 2*size()).data());
+    }
+
+    /// @brief In-place inverse transform of naturally ordered data.
+    virtual void inverse_inplace(T *data)
+    {
+        if (reorder_inplace(data))
+            inverse(data);
+        else
+            inverse(data, std::vector<T>(data, data + 2*size()).data());
+    }
+
+    /// @brief Transform size, in complex numbers
+    virtual int size() const noexcept=0;
+
+    /// @brief Order in which the in-place transform expects its input:
+    ///        element i of the scrambled array is element input_order()[i] of the original one.
+    ///        Null means bit-reversed order for power-of-two sizes and natural order otherwise.
+    virtual const int *input_order() const noexcept { return nullptr; }
+
+protected:
+    /// @brief Puts naturally ordered data in input_order() in place, if it's bit-reversed or natural
+    bool reorder_inplace(T *data)
+    {
+        if (input_order())
+            return false;
+        const int n = size();
+        if ((n & (n-1)) == 0)
+            scramble_inplace((complex<T>*)data, n);
+        return true;
+    }
+};
+
+/// @brief Lazily built implementation of a plan level
+///
+/// The implementation (and, with it, the twiddle tables it uses) is allocated separately
+/// and built on first use, so creating a plan is cheap and doesn't touch the tables.
+template <class Impl>
+class LazyImpl
+{
+public:
+    LazyImpl() : impl(nullptr) {}
+    ~LazyImpl() { delete impl.load(); }
+
+    LazyImpl(const LazyImpl &) = delete;
+    LazyImpl &operator=(const LazyImpl &) = delete;
+
+    Impl &get()
+    {
+        Impl *p = impl.load(std::memory_order_acquire);
+        if (!p)
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            p = impl.load(std::memory_order_relaxed);
+            if (!p)
+            {
+                p = new Impl();
+                impl.store(p, std::memory_order_release);
+            }
+        }
+        return *p;
+    }
+
+private:
+    std::atomic<Impl *> impl;
+    std::mutex lock;
 };
 
 template <int N, class T, class Impl>
-struct FFTLevel : FFTBase<T>, Impl
+struct FFTLevel : FFTBase<T>
+{
+    using FFTBase<T>::forward;
+    using FFTBase<T>::inverse;
+    void forward(T *data) override { impl.get().template transform_impl<false>(data); }
+    void inverse(T *data) override { impl.get().template transform_impl<true>(data); }
+
+    int size() const noexcept override { return N; }
+
+    static std::shared_ptr<FFTBase<T>> GetInstance()
+    {
+        return PlanRegistry<FFTBase<T>>::instance().template get<FFTLevel>(N, N*sizeof(complex<T>), []() { return new FFTLevel(); });
+    }
+
+private:
+    LazyImpl<Impl> impl;
+};
+
+/// @brief Runtime-sized FFT level; the size is passed to Impl's constructor
+template <class T, class Impl>
+struct FFTLevel<-1, T, Impl> : FFTBase<T>, Impl
 {
     void *operator new(size_t count)
     {
@@ -70,26 +219,99 @@ struct FFTLevel : FFTBase<T>, Impl
         free(p);
     }
 
+    template <class... Args>
+    explicit FFTLevel(Args&&... args) : Impl(std::forward<Args>(args)...) {}
+
+    using FFTBase<T>::forward;
+    using FFTBase<T>::inverse;
     void forward(T *data) override { Impl::template transform_impl<false>(data); }
     void inverse(T *data) override { Impl::template transform_impl<true>(data); }
 
-    static std::shared_ptr<FFTBase<T>> GetInstance()
+    int size() const noexcept override { return Impl::size(); }
+
+    /// @brief Returns the registry's plan of size n; the remaining arguments, which are
+    ///        determined by n, only matter when the plan has to be built
+    template <class... Args>
+    static std::shared_ptr<FFTBase<T>> GetInstance(int n, Args&&... args)
     {
-        auto shptr = instance.lock();
-        if (!shptr)
-        {
-            shptr.reset(new FFTLevel());
-            instance = shptr;
-        }
-        return shptr;
+        return PlanRegistry<FFTBase<T>>::instance().template get<FFTLevel>(n, n*sizeof(complex<T>),
+            [&]() { return new FFTLevel(n, std::forward<Args>(args)...); });
     }
+};
 
-private:
-    static std::weak_ptr<FFTBase<T>> instance;
+// Single-row decimation-in-frequency FFT
+
+/// @brief In-place FFT of naturally ordered data which leaves the result in bit-reversed order
+///
+/// Followed by a pointwise operation and an in-place (bit-reversed input) inverse transform,
+/// it gives a round trip without any reordering passes.
+template <class T>
+struct FFTDIFBase
+{
+    virtual ~FFTDIFBase()=default;
+
+    template <bool inv>
+    inline void transform(T *data)
+    {
+        if (inv)
+            inverse(data);
+        else
+            forward(data);
+    }
+
+    virtual void forward(T *)=0;
+    virtual void inverse(T *)=0;
+
+    /// @brief Transform size, in complex numbers
+    virtual int size() const noexcept=0;
 };
 
 template <int N, class T, class Impl>
-std::weak_ptr<FFTBase<T>> FFTLevel<N, T, Impl>::instance;
+struct FFTDIFLevel : FFTDIFBase<T>
+{
+    void forward(T *data) override { impl.get().template transform_impl<false>(data); }
+    void inverse(T *data) override { impl.get().template transform_impl<true>(data); }
+
+    int size() const noexcept override { return N; }
+
+    static std::shared_ptr<FFTDIFBase<T>> GetInstance()
+    {
+        return PlanRegistry<FFTDIFBase<T>>::instance().template get<FFTDIFLevel>(N, N*sizeof(complex<T>), []() { return new FFTDIFLevel(); });
+    }
+
+private:
+    LazyImpl<Impl> impl;
+};
+
+/// @brief Runtime-sized DIF level; the size is passed to Impl's constructor
+template <class T, class Impl>
+struct FFTDIFLevel<-1, T, Impl> : FFTDIFBase<T>, Impl
+{
+    void *operator new(size_t count)
+    {
+        return aligned_alloc_raw(count, alignof(FFTDIFLevel));
+    }
+    void operator delete(void *p)
+    {
+        free(p);
+    }
+
+    template <class... Args>
+    explicit FFTDIFLevel(Args&&... args) : Impl(std::forward<Args>(args)...) {}
+
+    void forward(T *data) override { Impl::template transform_impl<false>(data); }
+    void inverse(T *data) override { Impl::template transform_impl<true>(data); }
+
+    int size() const noexcept override { return Impl::size(); }
+
+    /// @brief Returns the registry's plan of size n - see FFTLevel<-1, T, Impl>::GetInstance
+    template <class... Args>
+    static std::shared_ptr<FFTDIFBase<T>> GetInstance(int n, Args&&... args)
+    {
+        return PlanRegistry<FFTDIFBase<T>>::instance().template get<FFTDIFLevel>(n, n*sizeof(complex<T>),
+            [&]() { return new FFTDIFLevel(n, std::forward<Args>(args)...); });
+    }
+};
 
 // Vertical multi-column FFT
 
@@ -119,7 +341,23 @@ struct FFTVertBase
 
 
 template <int N, class T, class Impl>
-struct FFTVertLevel : FFTVertBase<T>, Impl
+struct FFTVertLevel : FFTVertBase<T>
+{
+    void forward(T *data, int stride, int columns) override { return impl.get().template transform_impl<false>(data, stride, columns); }
+    void inverse(T *data, int stride, int columns) override { return impl.get().template transform_impl<true>(data, stride, columns); }
+
+    static std::shared_ptr<FFTVertBase<T>> GetInstance()
+    {
+        return PlanRegistry<FFTVertBase<T>>::instance().template get<FFTVertLevel>(N, N*sizeof(complex<T>), []() { return new FFTVertLevel(); });
+    }
+
+private:
+    LazyImpl<Impl> impl;
+};
+
+/// @brief Runtime-sized vertical FFT level; the size is passed to Impl's constructor
+template <class T, class Impl>
+struct FFTVertLevel<-1, T, Impl> : FFTVertBase<T>, Impl
 {
     void *operator new(size_t count)
     {
@@ -130,27 +368,21 @@ struct FFTVertLevel : FFTVertBase<T>, Impl
         free(p);
     }
 
+    template <class... Args>
+    explicit FFTVertLevel(Args&&... args) : Impl(std::forward<Args>(args)...) {}
+
     void forward(T *data, int stride, int columns) override { return Impl::template transform_impl<false>(data, stride, columns); }
     void inverse(T *data, int stride, int columns) override { return Impl::template transform_impl<true>(data, stride, columns); }
 
-    static std::shared_ptr<FFTVertLevel> GetInstance()
+    /// @brief Returns the registry's plan of size n - see FFTLevel<-1, T, Impl>::GetInstance
+    template <class... Args>
+    static std::shared_ptr<FFTVertBase<T>> GetInstance(int n, Args&&... args)
     {
-        auto shptr = instance.lock();
-        if (!shptr)
-        {
-            shptr.reset(new FFTVertLevel());
-            instance = shptr;
-        }
-        return shptr;
+        return PlanRegistry<FFTVertBase<T>>::instance().template get<FFTVertLevel>(n, n*sizeof(complex<T>),
+            [&]() { return new FFTVertLevel(n, std::forward<Args>(args)...); });
     }
-
-private:
-    static std::weak_ptr<FFTVertLevel> instance;
 };
 
-template <int N, class T, class Impl>
-std::weak_ptr<FFTVertLevel<N, T, Impl>> FFTVertLevel<N, T, Impl>::instance;
-
 } // impl
 } // genfft
 
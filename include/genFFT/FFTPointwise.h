@@ -0,0 +1,50 @@
+/*
+Copyright 2026 Michal Zientkiewicz
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef FFT_POINTWISE_H
+#define FFT_POINTWISE_H
+
+#include <memory>
+
+namespace genfft {
+namespace impl {
+
+// Pointwise operations on spectra
+template <class T>
+struct FFTPointwiseBase {
+    virtual ~FFTPointwiseBase()=default;
+
+    /// @brief Multiplies n interleaved complex numbers in inout by the ones in w
+    virtual void multiply(T *inout, const T *w, int n) const noexcept=0;
+
+    /// @brief Adds the products of n interleaved complex numbers in x and w to acc
+    virtual void multiply_add(T *acc, const T *x, const T *w, int n) const noexcept=0;
+};
+
+} // impl
+} // genfft
+
+#endif /* FFT_POINTWISE_H */
@@ -66,14 +66,75 @@ void separate_2x_real_FFT(std::complex<T> *out1, std::complex<T> *out2, const st
 }
 
 
+///@brief A 1D FFT for densely packed data
+///@tparam T scalar type
+template <class T, FFTImplFactory<T> *factory = backend::GetImpl, FFTDITImplFactory<T> *dit_factory = backend::GetDITImpl,
+          FFTImplFactory<T> *tuned_factory = backend::GetTunedImpl>
+struct RealFFT
+{
+    RealFFT()=default;
+    RealFFT(int n)
+    {
+        if (n > 1) {
+            impl = factory(n / 2, T());
+            // the inverse transforms naturally ordered data and can use whichever plan is fastest
+            natural = tuned_factory(n / 2, T());
+            dit = dit_factory(n, T());
+        }
+        this->n = n;
+    }
+
+    /// @brief Computes forward transform of real-valued signal
+    /// @param half if true, only N/2+1 values are stored
+    ///             if false, the upper half of the spectrum is reconstituted
+    void forward(std::complex<T> *out, const T *in, bool half)
+    {
+        if (n == 1) {
+            out[0] = in[0];
+        } else {
+            scramble((complex<T> *)out, (const complex<T>*)in, n / 2, impl->input_order());
+            impl->forward((T*)out);
+            dit->apply((T*)out, (T*)out, half);
+        }
+    }
+
+    /// @brief Computes inverse transform of a real-valued signal's spectrum
+    ///
+    ///        Like the complex inverse, the result isn't normalized: inverse(forward(x)) = n*x
+    /// @param out     n real values; may alias in_half
+    /// @param in_half the first n/2+1 values of the spectrum (the rest follows from symmetry)
+    void inverse(T *out, const std::complex<T> *in_half)
+    {
+        if (n == 1) {
+            out[0] = in_half[0].real();
+        } else {
+            dit->apply_inverse(out, (const T*)in_half);
+            natural->template transform_inplace<true>(out);
+        }
+    }
+
+    int size() const noexcept { return n; }
+
+private:
+    FFTImplPtr<T> impl, natural;
+    FFTDITImplPtr<T> dit;
+    int n = 0;
+};
+
 ///@brief 2D FFT
+///
+///The inverse transform uses a workspace owned by the object, allocated by the constructor;
+///an object must not be used by several threads at once.
 ///@tparam T scalar type
 template <class T>
 class RealFFT2D
 {
 public:
     RealFFT2D() = default;
-    RealFFT2D(int width, int height) : horz(width), vert(height) {}
+    RealFFT2D(int width, int height) : horz(width), vert(height), row(width)
+    {
+        work.resize((size_t)height * vert_cols());
+    }
 
     ///@brief Computes forward transform
     ///@param out output array, must not be equal to in
@@ -119,14 +180,24 @@ public:
 
 
 
-    ///@brief Computes inverse transform
-    ///@param out output array, must not be equal to in
+    ///@brief Computes inverse transform of a real-valued signal's spectrum
+    ///
+    ///       Only the first cols()/2+1 columns of the input are read - the rest follows from symmetry.
+    ///       The columns are transformed vertically and then each row, which is now the spectrum
+    ///       of a real signal, goes through RealFFT::inverse.
+    ///       Like the complex inverse, the result isn't normalized.
+    ///@param out output array; may alias in
     ///@param out_stride stride, in scalar elements, of the output array
     ///@param in input array
     ///@param in_stride stride, in complex elements, of the input array
     void inverse(T *out, int out_stride, const std::complex<T> *in, int in_stride)
     {
-        assert(!"TODO");
+        const int N = rows();
+        const int vcols = vert_cols();
+        scramble_rows(work.data(), vcols, in, in_stride, N, cols()/2+1);
+        vert.template transform_no_scramble<true>(work.data(), vcols, vcols);
+        for (int i=0; i<N; i++)
+            row.inverse(out + (stride_t)i*out_stride, &work[(size_t)i*vcols]);
     }
 
     ///@brief Number of columns in the domain
@@ -181,43 +252,8 @@ private:
 
     FFT<T>          horz;
     FFTVert<T>      vert;
-};
-
-///@brief A 1D FFT for densely packed data
-///@tparam T scalar type
-template <class T, FFTImplFactory<T> *factory = backend::GetImpl, FFTDITImplFactory<T> *dit_factory = backend::GetDITImpl>
-struct RealFFT
-{
-    RealFFT()=default;
-    RealFFT(int n)
-    {
-        if (n > 1) {
-            impl = factory(n / 2, T());
-            dit = dit_factory(n, T());
-        }
-        this->n = n;
-    }
-
-    /// @brief Computes forward transform of real-valued signal
-    /// @param half if true, only N/2+1 values are stored
-    ///             if false, the upper half of the spectrum is reconstituted
-    void forward(std::complex<T> *out, const T *in, bool half)
-    {
-        if (n == 1) {
-            out[0] = in[0];
-        } else {
-            scramble((complex<T> *)out, (const complex<T>*)in, n / 2);
-            impl->forward((T*)out);
-            dit->apply((T*)out, (T*)out, half);
-        }
-    }
-
-    int size() const noexcept { return n; }
-
-private:
-    FFTImplPtr<T> impl;
-    FFTDITImplPtr<T> dit;
-    int n = 0;
+    RealFFT<T>      row;
+    std::vector<std::complex<T>> work;
 };
 
 } // genFFT
@@ -0,0 +1,294 @@
+/*
+Copyright 2026 Michal Zientkiewicz
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef GEN_FFT_REGISTRY_H
+#define GEN_FFT_REGISTRY_H
+
+#include "FFTTypes.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace genfft {
+namespace impl {
+
+/// @brief An address that uniquely identifies a plan class.
+///
+/// The plan class determines the scalar type, the kind of the transform and the ISA
+/// namespace the plan was compiled for, so (size, tag) is a complete plan key.
+template <class Plan>
+struct PlanTag
+{
+    static const char id;
+};
+
+template <class Plan>
+const char PlanTag<Plan>::id = 0;
+
+/// @brief Retention state of a registry slot
+struct PlanUsage
+{
+    PlanUsage() : retained(false), last_use(0) {}
+    std::atomic<bool> retained;
+    std::atomic<unsigned long long> last_use;
+};
+
+/// @brief Strong references to plans, held by the registries according to PlanRetention
+///
+/// The policy is shared by all registries. Marking a plan as used is lock-free;
+/// the lock is only taken when a plan enters the cache and when plans are evicted.
+class PlanCache
+{
+public:
+    static PlanCache &instance()
+    {
+        static PlanCache *cache = new PlanCache();
+        return *cache;
+    }
+
+    void set_policy(PlanRetention policy, size_t budget)
+    {
+        std::vector<std::shared_ptr<void>> evicted;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            current.store(policy, std::memory_order_relaxed);
+            this->budget = budget;
+            evict(evicted);
+        }
+    }
+
+    /// @brief Records a use of a plan; it is retained if the policy says so
+    /// @param bytes approximate amount of memory the plan refers to
+    void use(PlanUsage &usage, const std::shared_ptr<void> &plan, size_t bytes)
+    {
+        if (current.load(std::memory_order_relaxed) == PlanRetention::Weak)
+            return;
+        usage.last_use.store(clock.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+        if (usage.retained.load(std::memory_order_relaxed) || usage.retained.exchange(true))
+            return;
+
+        std::vector<std::shared_ptr<void>> evicted;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            entries.push_back({ &usage, plan, bytes });
+            total += bytes;
+            evict(evicted);
+        }
+    }
+
+private:
+    PlanCache() : current(PlanRetention::Weak), clock(0) {}
+
+    struct Entry
+    {
+        PlanUsage *usage;
+        std::shared_ptr<void> plan;
+        size_t bytes;
+    };
+
+    /// @brief Removes the entries that exceed the policy; the plans are released by the caller,
+    ///        outside of the lock
+    void evict(std::vector<std::shared_ptr<void>> &evicted)
+    {
+        PlanRetention policy = current.load(std::memory_order_relaxed);
+        while (!entries.empty() && (policy == PlanRetention::Weak ||
+                                    (policy == PlanRetention::LRU && total > budget)))
+        {
+            size_t oldest = 0;
+            for (size_t i = 1; i < entries.size(); i++)
+                if (entries[i].usage->last_use.load(std::memory_order_relaxed) <
+                    entries[oldest].usage->last_use.load(std::memory_order_relaxed))
+                    oldest = i;
+            Entry &e = entries[oldest];
+            e.usage->retained.store(false);
+            total -= e.bytes;
+            evicted.push_back(std::move(e.plan));
+            e = std::move(entries.back());
+            entries.pop_back();
+        }
+    }
+
+    std::atomic<PlanRetention> current;
+    std::atomic<unsigned long long> clock;
+    std::mutex lock;
+    std::vector<Entry> entries;
+    size_t total = 0, budget = 0;
+};
+
+/// @brief Thread-safe cache of plans implementing the interface Base
+///
+/// Plans are keyed on their size and class (see PlanTag). Looking up a plan that exists
+/// is lock-free. A new plan is constructed under the lock of its own slot, so building one
+/// size doesn't block lookups or construction of other sizes.
+///
+/// Unless PlanCache retains it (see PlanRetention), a plan is destroyed when the last
+/// reference returned by get() is dropped and it is built again on the next lookup.
+template <class Base>
+class PlanRegistry
+{
+public:
+    static PlanRegistry &instance()
+    {
+        // never destroyed - plans may outlive static destruction of the registry
+        static PlanRegistry *registry = new PlanRegistry();
+        return *registry;
+    }
+
+    /// @brief Returns a plan of class Plan and given size, calling create() if there is none
+    /// @param bytes  approximate amount of memory the plan refers to, for PlanRetention::LRU
+    /// @param create a function returning a new Plan, allocated with new
+    template <class Plan, class Factory>
+    std::shared_ptr<Base> get(int size, size_t bytes, Factory &&create)
+    {
+        Node &node = find(size, &PlanTag<Plan>::id);
+        auto plan = node.slot.acquire(create);
+        PlanCache::instance().use(node.usage, plan, bytes);
+        return plan;
+    }
+
+private:
+    PlanRegistry()
+    {
+        for (auto &bucket : buckets)
+            bucket = nullptr;
+    }
+
+    PlanRegistry(const PlanRegistry &) = delete;
+    PlanRegistry &operator=(const PlanRegistry &) = delete;
+
+    /// @brief Holds a plan and the number of references to it
+    ///
+    /// The count only goes up from zero under the lock, which is also where the plan
+    /// is created and destroyed; other increments are done lock-free with CAS.
+    class Slot
+    {
+    public:
+        Slot() : plan(nullptr), refs(0) {}
+
+        template <class Factory>
+        std::shared_ptr<Base> acquire(Factory &create)
+        {
+            long r = refs.load(std::memory_order_relaxed);
+            while (r > 0)
+            {
+                if (refs.compare_exchange_weak(r, r+1, std::memory_order_acquire, std::memory_order_relaxed))
+                    return handle(plan.load(std::memory_order_relaxed));
+            }
+
+            std::lock_guard<std::mutex> guard(lock);
+            Base *p = plan.load(std::memory_order_relaxed);
+            if (!p)
+            {
+                p = create();
+                plan.store(p, std::memory_order_relaxed);
+            }
+            refs.fetch_add(1, std::memory_order_acq_rel);
+            return handle(p);
+        }
+
+    private:
+        struct Release
+        {
+            Slot *slot;
+            void operator()(Base *) const { slot->release(); }
+        };
+
+        std::shared_ptr<Base> handle(Base *p)
+        {
+            return std::shared_ptr<Base>(p, Release{this});
+        }
+
+        void release()
+        {
+            if (refs.fetch_sub(1, std::memory_order_acq_rel) != 1)
+                return;
+            Base *dead = nullptr;
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                // the plan may have been picked up again in the meantime
+                if (refs.load(std::memory_order_relaxed) == 0)
+                {
+                    dead = plan.load(std::memory_order_relaxed);
+                    plan.store(nullptr, std::memory_order_relaxed);
+                }
+            }
+            delete dead;
+        }
+
+        std::atomic<Base *> plan;
+        std::atomic<long> refs;
+        std::mutex lock;
+    };
+
+    struct Node
+    {
+        Node(int size, const void *tag) : size(size), tag(tag) {}
+        int size;
+        const void *tag;
+        Node *next = nullptr;
+        Slot slot;
+        PlanUsage usage;
+    };
+
+    enum { num_buckets = 64 };
+
+    /// @brief Finds or inserts the node for a key; nodes are never removed
+    Node &find(int size, const void *tag)
+    {
+        uintptr_t h = (uintptr_t)tag / 8 + (unsigned)size * 0x9E3779B1u;
+        std::atomic<Node *> &head = buckets[(h ^ (h >> 16)) % num_buckets];
+        Node *first = head.load(std::memory_order_acquire);
+        for (Node *n = first; n; n = n->next)
+            if (n->size == size && n->tag == tag)
+                return *n;
+
+        Node *node = new Node(size, tag);
+        for (;;)
+        {
+            node->next = first;
+            if (head.compare_exchange_weak(first, node, std::memory_order_release, std::memory_order_acquire))
+                return *node;
+            // check the nodes inserted since the last scan
+            for (Node *n = first; n != node->next; n = n->next)
+            {
+                if (n->size == size && n->tag == tag)
+                {
+                    delete node;
+                    return *n;
+                }
+            }
+        }
+    }
+
+    std::atomic<Node *> buckets[num_buckets];
+};
+
+} // impl
+} // genfft
+
+#endif /* GEN_FFT_REGISTRY_H */
@@ -0,0 +1,1076 @@
+/*
+Copyright 2026 Michal Zientkiewicz
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef GEN_FFT_SINE_TABLE_H
+#define GEN_FFT_SINE_TABLE_H
+
+namespace genfft {
+namespace impl {
+
+/// @brief Read-only quarter-wave sine table: values[i] = sin(2*pi*i/size) for 0 <= i <= size/4
+///
+/// The twiddle factors of all power-of-two sizes up to `size` are subsamples of this table,
+/// so they can be built without any calls to libm. The values are correctly rounded.
+template <class Dummy = void>
+struct SineTable
+{
+    enum { log2size = 14, size = 1 << log2size };
+    static const double values[size/4 + 1];
+};
+
+template <class Dummy>
+const double SineTable<Dummy>::values[SineTable<Dummy>::size/4 + 1] = {
+    0.0, 0.00038349518757139556, 0.0007669903187427045, 0.0011504853371138485,
+    0.0015339801862847657, 0.001917474809855419, 0.0023009691514258054, 0.0026844631545959617,
+    0.003067956762965976, 0.0034514499201359944, 0.003834942569706228, 0.004218434655276964,
+    0.0046019261204485705, 0.0049854169088215106, 0.005368906963996343, 0.005752396229573737,
+    0.006135884649154475, 0.006519372166339468, 0.006902858724729756, 0.007286344267926522,
+    0.007669828739531098, 0.008053312083144972, 0.0084367942423698, 0.008820275160807411,
+    0.00920375478205982, 0.009587233049729225, 0.009970709907418029, 0.010354185298728844,
+    0.010737659167264492, 0.011121131456628021, 0.011504602110422715, 0.011888071072252093,
+    0.012271538285719925, 0.012655003694430242, 0.013038467241987333, 0.013421928871995767,
+    0.01380538852806039, 0.014188846153786345, 0.014572301692779066, 0.014955755088644298,
+    0.015339206284988102, 0.015722655225416857, 0.016106101853537287, 0.016489546112956437,
+    0.016872987947281714, 0.01725642730012088, 0.017639864115082057, 0.018023298335773742,
+    0.01840672990580482, 0.018790158768784558, 0.019173584868322623, 0.019557008148029086,
+    0.019940428551514438, 0.020323846022389597, 0.020707260504265895, 0.02109067194075512,
+    0.021474080275469508, 0.021857485452021735, 0.02224088741402496, 0.022624286105092806,
+    0.023007681468839372, 0.02339107344887926, 0.023774461988827558, 0.024157847032299864,
+    0.024541228522912288, 0.024924606404281468, 0.02530798062002457, 0.0256913511137593,
+    0.0260747178291039, 0.026458080709677187, 0.02684143969909853, 0.027224794740987875,
+    0.027608145778965743, 0.027991492756653247, 0.0283748356176721, 0.028758174305644615,
+    0.029141508764193726, 0.02952483893694298, 0.029908164767516558, 0.030291486199539284,
+    0.030674803176636626, 0.031058115642434703, 0.0314414235405603, 0.03182472681464089,
+    0.032208025408304586, 0.032591319265180226, 0.032974608328897335, 0.033357892543086146,
+    0.03374117185137759, 0.034124446197403326, 0.03450771552479576, 0.034890979777188004,
+    0.035274238898213954, 0.03565749283150823, 0.03604074152070622, 0.03642398490944411,
+    0.03680722294135883, 0.03719045556008812, 0.0375736827092705, 0.03795690433254531,
+    0.038340120373552694, 0.03872333077593362, 0.03910653548332989, 0.039489734439384125,
+    0.03987292758773981, 0.04025611487204128, 0.040639296235933736, 0.041022471623063245,
+    0.04140564097707674, 0.04178880424162207, 0.04217196136034795, 0.04255511227690402,
+    0.04293825693494082, 0.043321395278109825, 0.04370452725006342, 0.044087652794454944,
+    0.04447077185493867, 0.044853884375169815, 0.04523699029880459, 0.04562008956950015,
+    0.04600318213091463, 0.04638626792670716, 0.04676934690053786, 0.04715241899606787,
+    0.0475354841569593, 0.047918542326875334, 0.048301593449480144, 0.04868463746843894,
+    0.049067674327418015, 0.049450703970084664, 0.049833726340107284, 0.05021674138115531,
+    0.05059974903689928, 0.0509827492510108, 0.05136574196716259, 0.05174872712902846,
+    0.052131704680283324, 0.05251467456460322, 0.052897636725665324, 0.053280591107147945,
+    0.05366353765273053, 0.05404647630609367, 0.05442940701091913, 0.054812329710889854,
+    0.05519524434968994, 0.055578150871004685, 0.05596104921852057, 0.05634393933592529,
+    0.05672682116690775, 0.05710969465515806, 0.05749255974436757, 0.057875416378228864,
+    0.05825826450043576, 0.05864110405468334, 0.05902393498466793, 0.05940675723408715,
+    0.059789570746639875, 0.060172375466026266, 0.06055517133594779, 0.0609379583001072,
+    0.06132073630220858, 0.061703505285957305, 0.062086265195060095, 0.062469015973224996,
+    0.06285175756416142, 0.06323448991158008, 0.06361721295919309, 0.06399992665071394,
+    0.06438263092985747, 0.06476532574033989, 0.06514801102587883, 0.06553068673019333,
+    0.06591335279700382, 0.06629600917003213, 0.06667865579300157, 0.06706129260963682,
+    0.06744391956366406, 0.06782653659881087, 0.06820914365880633, 0.06859174068738094,
+    0.06897432762826675, 0.06935690442519721, 0.0697394710219073, 0.07012202736213353,
+    0.07050457338961387, 0.07088710904808782, 0.0712696342812964, 0.07165214903298221,
+    0.07203465324688932, 0.07241714686676341, 0.07279962983635167, 0.07318210209940289,
+    0.07356456359966743, 0.0739470142808972, 0.07432945408684576, 0.07471188296126823,
+    0.07509430084792132, 0.0754767076905634, 0.07585910343295445, 0.07624148801885607,
+    0.07662386139203149, 0.07700622349624564, 0.07738857427526505, 0.07777091367285796,
+    0.07815324163279425, 0.07853555809884548, 0.07891786301478496, 0.07930015632438761,
+    0.07968243797143013, 0.08006470789969089, 0.08044696605295001, 0.08082921237498933,
+    0.08121144680959244, 0.08159366930054465, 0.08197587979163308, 0.08235807822664655,
+    0.08274026454937569, 0.08312243870361292, 0.08350460063315243, 0.08388675028179021,
+    0.08426888759332407, 0.08465101251155362, 0.08503312498028028, 0.08541522494330733,
+    0.0857973123444399, 0.0861793871274849, 0.08656144923625117, 0.08694349861454938,
+    0.08732553520619207, 0.08770755895499367, 0.0880895698047705, 0.08847156769934077,
+    0.0888535525825246, 0.08923552439814401, 0.08961748309002297, 0.08999942860198736,
+    0.09038136087786498, 0.09076327986148564, 0.09114518549668102, 0.09152707772728483,
+    0.09190895649713272, 0.09229082175006235, 0.09267267342991331, 0.09305451148052725,
+    0.09343633584574779, 0.09381814646942055, 0.0941999432953932, 0.09458172626751545,
+    0.094963495329639, 0.09534525042561763, 0.09572699149930718, 0.09610871849456551,
+    0.09649043135525259, 0.09687213002523047, 0.09725381444836327, 0.09763548456851721,
+    0.0980171403295606, 0.0983987816753639, 0.09878040854979964, 0.0991620208967425,
+    0.09954361866006933, 0.09992520178365907, 0.10030677021139286, 0.10068832388715396,
+    0.10106986275482782, 0.10145138675830208, 0.10183289584146654, 0.1022143899482132,
+    0.1025958690224363, 0.10297733300803222, 0.10335878184889963, 0.10374021548893937,
+    0.10412163387205457, 0.10450303694215057, 0.10488442464313497, 0.1052657969189176,
+    0.10564715371341062, 0.10602849497052841, 0.10640982063418768, 0.10679113064830739,
+    0.10717242495680884, 0.10755370350361564, 0.10793496623265365, 0.10831621308785117,
+    0.10869744401313872, 0.10907865895244924, 0.10945985784971798, 0.1098410406488826,
+    0.11022220729388306, 0.11060335772866174, 0.11098449189716339, 0.11136560974333516,
+    0.1117467112111266, 0.11212779624448965, 0.11250886478737869, 0.11288991678375052,
+    0.11327095217756435, 0.11365197091278187, 0.11403297293336721, 0.11441395818328692,
+    0.11479492660651008, 0.11517587814700819, 0.11555681274875527, 0.1159377303557278,
+    0.11631863091190477, 0.11669951436126769, 0.11708038064780059, 0.11746122971548999,
+    0.11784206150832498, 0.11822287597029717, 0.11860367304540072, 0.11898445267763236,
+    0.11936521481099137, 0.1197459593894796, 0.12012668635710151, 0.12050739565786413,
+    0.12088808723577708, 0.1212687610348526, 0.12164941699910553, 0.12203005507255336,
+    0.1224106751992162, 0.12279127732311677, 0.12317186138828048, 0.12355242733873538,
+    0.12393297511851217, 0.12431350467164425, 0.12469401594216765, 0.12507450887412117,
+    0.12545498341154623, 0.125835439498487, 0.12621587707899035, 0.12659629609710588,
+    0.12697669649688587, 0.1273570782223854, 0.1277374412176623, 0.12811778542677713,
+    0.12849811079379317, 0.12887841726277655, 0.12925870477779614, 0.1296389732829236,
+    0.13001922272223335, 0.13039945303980272, 0.1307796641797117, 0.13115985608604327,
+    0.13154002870288312, 0.13192018197431976, 0.13230031584444468, 0.13268043025735207,
+    0.13306052515713906, 0.13344060048790568, 0.13382065619375474, 0.13420069221879202,
+    0.1345807085071262, 0.13496070500286877, 0.13534068165013421, 0.13572063839303994,
+    0.1361005751757062, 0.13648049194225628, 0.13686038863681638, 0.1372402652035156,
+    0.13762012158648604, 0.1379999577298628, 0.1383797735777839, 0.13875956907439035,
+    0.1391393441638262, 0.1395190987902385, 0.13989883289777721, 0.14027854643059542,
+    0.14065823933284924, 0.14103791154869771, 0.14141756302230304, 0.1417971936978304,
+    0.14217680351944806, 0.14255639243132734, 0.14293596037764267, 0.1433155073025715,
+    0.14369503315029444, 0.1440745378649952, 0.14445402139086047, 0.1448334836720802,
+    0.14521292465284746, 0.14559234427735837, 0.14597174248981223, 0.1463511192344115,
+    0.14673047445536175, 0.1471098080968718, 0.1474891201031536, 0.14786841041842222,
+    0.14824767898689603, 0.14862692575279654, 0.14900615066034847, 0.14938535365377972,
+    0.1497645346773215, 0.1501436936752082, 0.15052283059167743, 0.15090194537097004,
+    0.15128103795733022, 0.15166010829500534, 0.15203915632824605, 0.15241818200130633,
+    0.15279718525844344, 0.15317616604391784, 0.15355512430199345, 0.15393405997693738,
+    0.1543129730130201, 0.15469186335451543, 0.15507073094570054, 0.15544957573085583,
+    0.15582839765426523, 0.1562071966602159, 0.15658597269299845, 0.15696472569690678,
+    0.15734345561623825, 0.15772216239529363, 0.158100845978377, 0.15847950630979596,
+    0.15885814333386145, 0.15923675699488787, 0.15961534723719303, 0.15999391400509827,
+    0.16037245724292826, 0.16075097689501122, 0.1611294729056788, 0.16150794521926615,
+    0.16188639378011183, 0.16226481853255803, 0.16264321942095034, 0.16302159638963784,
+    0.16339994938297323, 0.16377827834531267, 0.16415658322101584, 0.164534863954446,
+    0.16491312048996992, 0.165291352771958, 0.16566956074478412, 0.1660477443528258,
+    0.16642590354046413, 0.16680403825208373, 0.16718214843207294, 0.1675602340248236,
+    0.16793829497473117, 0.16831633122619485, 0.16869434272361733, 0.16907232941140501,
+    0.16945029123396796, 0.16982822813571985, 0.17020614006107807, 0.17058402695446362,
+    0.17096188876030122, 0.1713397254230193, 0.17171753688704997, 0.172095323096829,
+    0.17247308399679598, 0.17285081953139408, 0.17322852964507032, 0.17360621428227543,
+    0.17398387338746382, 0.17436150690509378, 0.17473911477962722, 0.17511669695552992,
+    0.17549425337727143, 0.17587178398932504, 0.17624928873616788, 0.17662676756228088,
+    0.17700422041214875, 0.17738164723026006, 0.17775904796110717, 0.1781364225491863,
+    0.17851377093899753, 0.17889109307504475, 0.17926838890183575, 0.17964565836388216,
+    0.18002290140569951, 0.18040011797180724, 0.1807773080067286, 0.1811544714549908,
+    0.181531608261125, 0.18190871836966618, 0.1822858017251533, 0.1826628582721293,
+    0.18303988795514095, 0.1834168907187391, 0.18379386650747845, 0.18417081526591772,
+    0.18454773693861962, 0.18492463147015079, 0.1853014988050819, 0.18567833888798763,
+    0.18605515166344666, 0.1864319370760416, 0.18680869507035927, 0.18718542559099033,
+    0.1875621285825296, 0.1879388039895759, 0.18831545175673212, 0.18869207182860523,
+    0.18906866414980622, 0.18944522866495023, 0.18982176531865644, 0.19019827405554815,
+    0.19057475482025277, 0.1909512075574018, 0.1913276322116309, 0.1917040287275798,
+    0.19208039704989244, 0.19245673712321684, 0.19283304889220523, 0.193209332301514,
+    0.19358558729580363, 0.19396181381973887, 0.19433801181798863, 0.194714181235226,
+    0.19509032201612828, 0.19546643410537698, 0.19584251744765788, 0.19621857198766088,
+    0.19659459767008022, 0.19697059443961434, 0.19734656224096592, 0.19772250101884192,
+    0.1980984107179536, 0.19847429128301639, 0.19885014265875012, 0.19922596478987886,
+    0.19960175762113097, 0.19997752109723918, 0.20035325516294045, 0.20072895976297614,
+    0.2011046348420919, 0.20148028034503776, 0.20185589621656805, 0.20223148240144148,
+    0.20260703884442113, 0.20298256549027446, 0.20335806228377332, 0.20373352916969392,
+    0.20410896609281687, 0.20448437299792724, 0.20485974982981442, 0.20523509653327235,
+    0.20561041305309927, 0.20598569933409794, 0.2063609553210755, 0.2067361809588437,
+    0.20711137619221856, 0.20748654096602065, 0.20786167522507507, 0.20823677891421133,
+    0.20861185197826349, 0.20898689436207007, 0.20936190601047416, 0.2097368868683233,
+    0.2101118368804696, 0.21048675599176975, 0.21086164414708486, 0.2112365012912807,
+    0.21161132736922758, 0.21198612232580033, 0.21236088610587844, 0.21273561865434593,
+    0.21311031991609136, 0.21348498983600805, 0.21385962835899378, 0.214234235429951,
+    0.21460881099378676, 0.21498335499541285, 0.21535786737974555, 0.21573234809170588,
+    0.21610679707621952, 0.21648121427821676, 0.21685559964263262, 0.2172299531144068,
+    0.21760427463848364, 0.21797856415981223, 0.21835282162334632, 0.21872704697404444,
+    0.2191012401568698, 0.21947540111679031, 0.2198495297987787, 0.22022362614781238,
+    0.22059769010887353, 0.2209717216269491, 0.22134572064703084, 0.22171968711411522,
+    0.22209362097320354, 0.22246752216930188, 0.22284139064742114, 0.223215226352577,
+    0.22358902922979, 0.22396279922408546, 0.2243365362804936, 0.22471024034404943,
+    0.22508391135979283, 0.22545754927276854, 0.22583115402802617, 0.22620472557062019,
+    0.22657826384561, 0.22695176879805984, 0.22732524037303886, 0.22769867851562117,
+    0.22807208317088573, 0.22844545428391647, 0.22881879179980222, 0.2291920956636368,
+    0.2295653658205189, 0.22993860221555223, 0.23031180479384544, 0.23068497350051223,
+    0.2310581082806711, 0.23143120907944578, 0.23180427584196475, 0.2321773085133617,
+    0.23255030703877524, 0.23292327136334898, 0.23329620143223162, 0.23366909719057685,
+    0.23404195858354343, 0.23441478555629516, 0.23478757805400097, 0.23516033602183473,
+    0.23553305940497551, 0.23590574814860737, 0.23627840219791957, 0.23665102149810638,
+    0.2370236059943672, 0.2373961556319066, 0.23776867035593421, 0.23814115011166484,
+    0.23851359484431844, 0.23888600449912006, 0.23925837902129998, 0.2396307183560936,
+    0.2400030224487415, 0.24037529124448945, 0.24074752468858843, 0.24111972272629462,
+    0.24149188530286933, 0.2418640123635792, 0.24223610385369604, 0.24260815971849684,
+    0.2429801799032639, 0.24335216435328474, 0.24372411301385216, 0.2440960258302642,
+    0.24446790274782418, 0.24483974371184067, 0.24521154866762757, 0.24558331756050406,
+    0.24595505033579462, 0.24632674693882903, 0.24669840731494244, 0.24707003140947528,
+    0.2474416191677733, 0.24781317053518764, 0.24818468545707478, 0.24855616387879656,
+    0.24892760574572018, 0.2492990110032182, 0.24967037959666857, 0.25004171147145465,
+    0.2504130065729653, 0.2507842648465945, 0.2511554862377419, 0.2515266706918126,
+    0.25189781815421697, 0.2522689285703708, 0.2526400018856955, 0.2530110380456179,
+    0.25338203699557016, 0.25375299868099, 0.2541239230473206, 0.2544948100400108,
+    0.25486565960451457, 0.2552364716862917, 0.25560724623080744, 0.2559779831835324,
+    0.2563486824899429, 0.2567193440955207, 0.2570899679457531, 0.2574605539861331,
+    0.257831102162159, 0.2582016124193349, 0.25857208470317034, 0.2589425189591805,
+    0.25931291513288623, 0.25968327316981377, 0.2600535930154952, 0.260423874615468,
+    0.2607941179152755, 0.2611643228604665, 0.26153448939659546, 0.2619046174692226,
+    0.26227470702391364, 0.26264475800624004, 0.263014770361779, 0.2633847440361133,
+    0.2637546789748314, 0.26412457512352755, 0.26449443242780163, 0.26486425083325926,
+    0.2652340302855118, 0.2656037707301763, 0.2659734721128756, 0.2663431343792382,
+    0.26671275747489837, 0.26708234134549624, 0.2674518859366777, 0.26782139119409415,
+    0.2681908570634032, 0.2685602834902679, 0.2689296704203573, 0.2692990177993462,
+    0.2696683255729151, 0.27003759368675057, 0.2704068220865448, 0.270776010717996,
+    0.271145159526808, 0.2715142684586907, 0.2718833374593598, 0.2722523664745367,
+    0.272621355449949, 0.2729903043313299, 0.27335921306441874, 0.27372808159496054,
+    0.2740969098687064, 0.2744656978314132, 0.27483444542884394, 0.2752031526067673,
+    0.27557181931095814, 0.2759404454871972, 0.2763090310812711, 0.2766775760389724,
+    0.2770460803060999, 0.27741454382845815, 0.27778296655185764, 0.27815134842211514,
+    0.2785196893850531, 0.2788879893865002, 0.2792562483722912, 0.2796244662882666,
+    0.2799926430802732, 0.2803607786941638, 0.2807288730757972, 0.28109692617103826,
+    0.281464937925758, 0.28183290828583335, 0.28220083719714756, 0.2825687246055898,
+    0.28293657045705534, 0.28330437469744574, 0.28367213727266843, 0.2840398581286372,
+    0.2844075372112718, 0.2847751744664983, 0.2851427698402487, 0.2855103232784613,
+    0.2858778347270806, 0.2862453041320572, 0.2866127314393478, 0.2869801165949155,
+    0.2873474595447295, 0.28771476023476517, 0.28808201861100413, 0.2884492346194342,
+    0.2888164082060495, 0.28918353931685026, 0.2895506278978431, 0.28991767389504075,
+    0.2902846772544624, 0.2906516379221333, 0.29101855584408504, 0.29138543096635566,
+    0.29175226323498926, 0.29211905259603643, 0.2924857989955539, 0.2928525023796048,
+    0.29321916269425863, 0.2935857798855912, 0.29395235389968466, 0.2943188846826274,
+    0.2946853721805143, 0.2950518163394467, 0.295418217105532, 0.29578457442488426,
+    0.29615088824362384, 0.2965171585078774, 0.29688338516377827, 0.29724956815746584,
+    0.2976157074350862, 0.2979818029427918, 0.2983478546267414, 0.2987138624331004,
+    0.2990798263080405, 0.2994457461977399, 0.29981162204838335, 0.300177453806162,
+    0.30054324141727345, 0.3009089848279219, 0.30127468398431795, 0.3016403388326788,
+    0.3020059493192281, 0.30237151539019597, 0.3027370369918192, 0.30310251407034106,
+    0.3034679465720113, 0.30383333444308636, 0.3041986776298291, 0.3045639760785091,
+    0.30492922973540243, 0.30529443854679167, 0.3056596024589662, 0.3060247214182218,
+    0.306389795370861, 0.3067548242631928, 0.30711980804153305, 0.3074847466522041,
+    0.30784964004153487, 0.3082144881558611, 0.30857929094152503, 0.3089440483448757,
+    0.3093087603122687, 0.30967342679006643, 0.3100380477246379, 0.3104026230623588,
+    0.3107671527496115, 0.31113163673278527, 0.3114960749582759, 0.311860467372486,
+    0.31222481392182494, 0.3125891145527087, 0.3129533692115602, 0.313317577844809,
+    0.31368174039889146, 0.3140458568202507, 0.3144099270553367, 0.31477395105060607,
+    0.3151379287525224, 0.315501860107556, 0.315865745062184, 0.3162295835628903,
+    0.31659337555616585, 0.31695712098850815, 0.31732081980642174, 0.3176844719564179,
+    0.31804807738501495, 0.3184116360387378, 0.31877514786411854, 0.3191386128076959,
+    0.3195020308160157, 0.3198654018356305, 0.3202287258130999, 0.32059200269499033,
+    0.3209552324278752, 0.3213184149583349, 0.3216815502329566, 0.3220446381983345,
+    0.32240767880106985, 0.32277067198777076, 0.32313361770505233, 0.3234965158995367,
+    0.3238593665178529, 0.324222169506637, 0.32458492481253215, 0.32494763238218843,
+    0.3253102921622629, 0.3256729040994198, 0.32603546814033024, 0.3263979842316725,
+    0.3267604523201318, 0.3271228723524005, 0.327485244275178, 0.32784756803517084,
+    0.32820984357909255, 0.32857207085366374, 0.3289342498056122, 0.3292963803816728,
+    0.3296584625285875, 0.3300204961931054, 0.3303824813219828, 0.33074441786198294,
+    0.33110630575987643, 0.33146814496244087, 0.3318299354164611, 0.3321916770687292,
+    0.3325533698660442, 0.33291501375521265, 0.3332766086830479, 0.33363815459637086,
+    0.3339996514420094, 0.33436109916679874, 0.3347224977175813, 0.3350838470412066,
+    0.33544514708453166, 0.3358063977944205, 0.3361675991177445, 0.3365287510013824,
+    0.33688985339222005, 0.3372509062371506, 0.33761190948307457, 0.3379728630768998,
+    0.3383337669655412, 0.33869462109592124, 0.33905542541496964, 0.33941617986962336,
+    0.33977688440682685, 0.3401375389735318, 0.34049814351669716, 0.34085869798328944,
+    0.3412192023202824, 0.34157965647465716, 0.3419400603934022, 0.3423004140235135,
+    0.3426607173119944, 0.34302097020585554, 0.34338117265211504, 0.3437413245977985,
+    0.34410142598993887, 0.34446147677557654, 0.34482147690175935, 0.3451814263155426,
+    0.34554132496398904, 0.345901172794169, 0.34626096975316, 0.3466207157880474,
+    0.3469804108459237, 0.34734005487388914, 0.3476996478190514, 0.3480591896285256,
+    0.34841868024943456, 0.3487781196289084, 0.34913750771408497, 0.34949684445210955,
+    0.3498561297901349, 0.35021536367532163, 0.35057454605483757, 0.35093367687585836,
+    0.35129275608556715, 0.3516517836311546, 0.35201075945981913, 0.35236968351876663,
+    0.3527285557552107, 0.3530873761163725, 0.3534461445494808, 0.35380486100177205,
+    0.3541635254204904, 0.3545221377528875, 0.3548806979462228, 0.3552392059477633,
+    0.3555976617047839, 0.35595606516456685, 0.3563144162744024, 0.35667271498158826,
+    0.35703096123343003, 0.35738915497724094, 0.3577472961603419, 0.35810538473006165,
+    0.35846342063373654, 0.35882140381871086, 0.3591793342323365, 0.3595372118219731,
+    0.35989503653498817, 0.3602528083187569, 0.3606105271206623, 0.36096819288809523,
+    0.3613258055684543, 0.36168336510914584, 0.3620408714575842, 0.36239832456119137,
+    0.3627557243673972, 0.3631130708236395, 0.3634703638773638, 0.3638276034760235,
+    0.3641847895670799, 0.3645419220980022, 0.3648990010162673, 0.36525602626936027,
+    0.36561299780477385, 0.3659699155700088, 0.36632677951257364, 0.3666835895799849,
+    0.3670403457197672, 0.36739704787945276, 0.367753696006582, 0.36811029004870305,
+    0.3684668299533723, 0.3688233156681539, 0.36917974714061996, 0.3695361243183507,
+    0.3698924471489341, 0.3702487155799664, 0.37060492955905167, 0.370961089033802,
+    0.37131719395183754, 0.3716732442607865, 0.372029239908285, 0.37238518084197736,
+    0.3727410670095158, 0.37309689835856064, 0.3734526748367803, 0.37380839639185126,
+    0.374164062971458, 0.3745196745232932, 0.3748752309950576, 0.3752307323344599,
+    0.3755861784892172, 0.3759415694070545, 0.3762969050357048, 0.3766521853229096,
+    0.37700741021641826, 0.37736257966398834, 0.37771769361338564, 0.37807275201238405,
+    0.37842775480876556, 0.37878270195032054, 0.3791375933848473, 0.3794924290601526,
+    0.37984720892405116, 0.38020193292436605, 0.3805566010089285, 0.3809112131255781,
+    0.3812657692221624, 0.38162026924653736, 0.3819747131465673, 0.3823291008701245,
+    0.3826834323650898, 0.38303770757935207, 0.38339192646080866, 0.383746088957365,
+    0.38410019501693504, 0.3844542445874409, 0.3848082376168129, 0.38516217405298986,
+    0.38551605384391885, 0.3858698769375553, 0.386223643281863, 0.3865773528248139,
+    0.3869310055143886, 0.3872846012985758, 0.38763814012537273, 0.3879916219427849,
+    0.3883450466988263, 0.3886984143415192, 0.3890517248188944, 0.38940497807899094,
+    0.38975817406985647, 0.3901113127395469, 0.39046439403612665, 0.39081741790766855,
+    0.39117038430225387, 0.3915232931679724, 0.39187614445292235, 0.3922289381052103,
+    0.39258167407295147, 0.3929343523042695, 0.3932869727472964, 0.39363953535017293,
+    0.3939920400610481, 0.3943444868280796, 0.3946968755994336, 0.3950492063232848,
+    0.39540147894781635, 0.3957536934212201, 0.3961058496916963, 0.3964579477074539,
+    0.3968099874167103, 0.3971619687676916, 0.3975138917086323, 0.39786575618777575,
+    0.3982175621533736, 0.3985693095536863, 0.3989209983369829, 0.399272628451541,
+    0.39962419984564684, 0.39997571246759533, 0.4003271662656901, 0.40067856118824324,
+    0.4010298971835756, 0.40138117420001684, 0.401732392185905, 0.402083551089587,
+    0.40243465085941843, 0.4027856914437635, 0.4031366727909953, 0.4034875948494953,
+    0.40383845756765413, 0.4041892608938707, 0.404540004776553, 0.40489068916411763,
+    0.40524131400498986, 0.40559187924760387, 0.4059423848404025, 0.4062928307318374,
+    0.40664321687036903, 0.4069935432044665, 0.40734380968260797, 0.40769401625328017,
+    0.4080441628649787, 0.408394249466208, 0.4087442760054814, 0.409094242431321,
+    0.4094441486922576, 0.40979399473683115, 0.41014378051359024, 0.4104935059710924,
+    0.41084317105790397, 0.41119277572260016, 0.4115423199137652, 0.41189180357999217,
+    0.4122412266698829, 0.41259058913204827, 0.412939890915108, 0.41328913196769096,
+    0.41363831223843456, 0.41398743167598545, 0.4143364902289991, 0.41468548784614007,
+    0.41503442447608163, 0.4153833000675063, 0.41573211456910536, 0.4160808679295792,
+    0.4164295600976372, 0.41677819102199765, 0.4171267606513879, 0.41747526893454434,
+    0.4178237158202123, 0.4181721012571463, 0.41852042519410976, 0.4188686875798751,
+    0.41921688836322396, 0.4195650274929469, 0.4199131049178436, 0.4202611205867229,
+    0.4206090744484025, 0.42095696645170944, 0.42130479654547964, 0.42165256467855833,
+    0.4220002707997997, 0.42234791485806705, 0.422695496802233, 0.42304301658117904,
+    0.42339047414379605, 0.42373786943898384, 0.42408520241565156, 0.4244324730227174,
+    0.4247796812091088, 0.42512682692376236, 0.42547391011562385, 0.42582093073364824,
+    0.42616788872679967, 0.4265147840440515, 0.4268616166343865, 0.4272083864467963,
+    0.4275550934302821, 0.42790173753385413, 0.42824831870653196, 0.4285948368973444,
+    0.4289412920553295, 0.4292876841295346, 0.4296340130690164, 0.4299802788228406,
+    0.4303264813400826, 0.4306726205698268, 0.43101869646116703, 0.4313647089632064,
+    0.43171065802505726, 0.4320565435958415, 0.43240236562469014, 0.4327481240607437,
+    0.43309381885315196, 0.4334394499510741, 0.4337850173036786, 0.43413052086014337,
+    0.4344759605696557, 0.4348213363814123, 0.43516664824461926, 0.435511896108492,
+    0.4358570799222555, 0.43620219963514395, 0.4365472551964012, 0.43689224655528036,
+    0.4372371736610441, 0.43758203646296445, 0.43792683491032286, 0.4382715689524105,
+    0.43861623853852766, 0.4389608436179843, 0.43930538414009995, 0.4396498600542035,
+    0.43999427130963326, 0.44033861785573725, 0.4406828996418729, 0.44102711661740723,
+    0.44137126873171667, 0.4417153559341873, 0.44205937817421476, 0.4424033354012041,
+    0.44274722756457, 0.4430910546137369, 0.4434348164981385, 0.4437785131672183,
+    0.44412214457042926, 0.44446571065723406, 0.4448092113771049, 0.44515264667952364,
+    0.44549601651398174, 0.4458393208299803, 0.44618255957703007, 0.44652573270465135,
+    0.4468688401623742, 0.4472118818997383, 0.447554857866293, 0.4478977680115973,
+    0.44824061228521994, 0.44858339063673924, 0.4489261030157433, 0.4492687493718299,
+    0.4496113296546066, 0.4499538438136905, 0.45029629179870867, 0.45063867355929765,
+    0.45098098904510386, 0.4513232382057835, 0.4516654209910025, 0.4520075373504365,
+    0.4523495872337709, 0.4526915705907009, 0.45303348737093163, 0.45337533752417775,
+    0.45371712100016387, 0.45405883774862443, 0.45440048771930364, 0.45474207086195545,
+    0.45508358712634384, 0.45542503646224236, 0.4557664188194347, 0.4561077341477141,
+    0.4564489823968839, 0.4567901635167572, 0.457131277457157, 0.45747232416791606,
+    0.45781330359887723, 0.4581542156998931, 0.4584950604208263, 0.4588358377115492,
+    0.45917654752194415, 0.45951718980190354, 0.45985776450132954, 0.4601982715701343,
+    0.46053871095824, 0.4608790826155787, 0.4612193864920924, 0.4615596225377331,
+    0.46189979070246273, 0.46223989093625334, 0.4625799231890868, 0.46291988741095513,
+    0.4632597835518602, 0.463599611561814, 0.4639393713908385, 0.4642790629889658,
+    0.4646186863062378, 0.4649582412927067, 0.4652977278984346, 0.46563714607349366,
+    0.4659764957679662, 0.4663157769319445, 0.4666549895155309, 0.46699413346883806,
+    0.4673332087419884, 0.46767221528511477, 0.46801115304835983, 0.46835002198187653,
+    0.46868882203582796, 0.4690275531603872, 0.4693662153057375, 0.46970480842207246,
+    0.4700433324595956, 0.4703817873685207, 0.47072017309907166, 0.4710584896014825,
+    0.47139673682599764, 0.4717349147228715, 0.47207302324236866, 0.4724110623347641,
+    0.4727490319503428, 0.4730869320394001, 0.47342476255224153, 0.47376252343918285,
+    0.47410021465055, 0.4744378361366793, 0.4747753878479171, 0.4751128697346203,
+    0.47545028174715587, 0.4757876238359011, 0.47612489595124363, 0.47646209804358125,
+    0.47679923006332214, 0.4771362919608848, 0.47747328368669806, 0.477810205191201,
+    0.47814705642484306, 0.478483837338084, 0.47882054788139394, 0.4791571880052533,
+    0.479493757660153, 0.4798302567965942, 0.4801666853650884, 0.4805030433161575,
+    0.48083933060033396, 0.48117554716816036, 0.4815116929701899, 0.48184776795698603,
+    0.4821837720791228, 0.48251970528718435, 0.4828555675317657, 0.4831913587634719,
+    0.48352707893291874, 0.48386272799073227, 0.48419830588754903, 0.4845338125740162,
+    0.4848692480007911, 0.4852046121185419, 0.48553990487794696, 0.4858751262296953,
+    0.4862102761244864, 0.48654535451303027, 0.4868803613460474, 0.48721529657426876,
+    0.48755016014843594, 0.4878849520193011, 0.4882196721376268, 0.48855432045418623,
+    0.48888889691976317, 0.489223401485152, 0.4895578341011575, 0.4898921947185952,
+    0.49022648328829116, 0.490560699761082, 0.49089484408781514, 0.4912289162193483,
+    0.49156291610654995, 0.4918968437002993, 0.4922306989514861, 0.49256448181101065,
+    0.49289819222978404, 0.49323183015872796, 0.49356539554877477, 0.4938988883508675,
+    0.49423230851595973, 0.49456565599501595, 0.4948989307390112, 0.49523213269893124,
+    0.49556526182577254, 0.49589831807054224, 0.4962313013842583, 0.4965642117179493,
+    0.4968970490226545, 0.4972298132494242, 0.49756250434931915, 0.4978951222734109,
+    0.49822766697278187, 0.49856013839852514, 0.49889253650174464, 0.4992248612335551,
+    0.4995571125450819, 0.4998892903874614, 0.5002213947118406, 0.5005534254693775,
+    0.5008853826112408, 0.50121726608861, 0.5015490758526754, 0.5018808118546383,
+    0.5022124740457108, 0.5025440623771157, 0.502875576800087, 0.503207017265869,
+    0.5035383837257176, 0.503869676130899, 0.5042008944326904, 0.5045320385823803,
+    0.5048631085312676, 0.5051941042306622, 0.5055250256318854, 0.5058558726862689,
+    0.5061866453451553, 0.5065173435598985, 0.5068479672818633, 0.5071785164624252,
+    0.5075089910529709, 0.5078393910048978, 0.5081697162696146, 0.5084999667985408,
+    0.508830142543107, 0.5091602434547546, 0.5094902694849363, 0.5098202205851154,
+    0.5101500967067668, 0.5104798978013757, 0.510809623820439, 0.5111392747154644,
+    0.5114688504379704, 0.5117983509394869, 0.5121277761715547, 0.5124571260857258,
+    0.5127864006335631, 0.5131155997666406, 0.5134447234365435, 0.513773771594868,
+    0.5141027441932218, 0.5144316411832229, 0.5147604625165012, 0.5150892081446973,
+    0.515417878019463, 0.5157464720924614, 0.5160749903153666, 0.516403432639864,
+    0.5167317990176499, 0.517060089400432, 0.5173883037399291, 0.5177164419878711,
+    0.5180445040959993, 0.5183724900160661, 0.5187003996998351, 0.5190282330990809,
+    0.5193559901655896, 0.5196836708511585, 0.520011275107596, 0.520338802886722,
+    0.5206662541403672, 0.5209936288203739, 0.5213209268785957, 0.5216481482668971,
+    0.5219752929371544, 0.5223023608412547, 0.5226293519310966, 0.5229562661585901,
+    0.5232831034756564, 0.5236098638342279, 0.5239365471862486, 0.5242631534836734,
+    0.524589682678469, 0.524916134722613, 0.5252425095680947, 0.5255688071669147,
+    0.5258950274710846, 0.5262211704326281, 0.5265472360035793, 0.5268732241359847,
+    0.5271991347819014, 0.5275249678933982, 0.5278507234225553, 0.5281764013214644,
+    0.5285020015422285, 0.5288275240369619, 0.5291529687577906, 0.529478335656852,
+    0.5298036246862947, 0.5301288357982789, 0.5304539689449763, 0.5307790240785701,
+    0.531104001151255, 0.5314289001152368, 0.5317537209227333, 0.5320784635259735,
+    0.532403127877198, 0.5327277139286588, 0.5330522216326196, 0.5333766509413554,
+    0.533701001807153, 0.5340252741823104, 0.5343494680191375, 0.5346735832699555,
+    0.5349976198870973, 0.5353215778229071, 0.5356454570297411, 0.5359692574599667,
+    0.5362929790659632, 0.5366166218001212, 0.5369401856148429, 0.5372636704625425,
+    0.5375870762956455, 0.5379104030665889, 0.5382336507278217, 0.5385568192318042,
+    0.5388799085310084, 0.5392029185779182, 0.5395258493250289, 0.5398487007248476,
+    0.5401714727298929, 0.5404941652926952, 0.5408167783657967, 0.5411393119017509,
+    0.5414617658531234, 0.5417841401724915, 0.5421064348124439, 0.5424286497255814,
+    0.5427507848645159, 0.5430728401818719, 0.5433948156302848, 0.5437167111624024,
+    0.5440385267308839, 0.5443602622884003, 0.5446819177876345, 0.5450034931812812,
+    0.5453249884220465, 0.5456464034626486, 0.5459677382558176, 0.5462889927542952,
+    0.5466101669108349, 0.5469312606782022, 0.5472522740091741, 0.5475732068565399,
+    0.5478940591731002, 0.5482148309116678, 0.5485355220250674, 0.5488561324661353,
+    0.5491766621877198, 0.549497111142681, 0.5498174792838909, 0.5501377665642336,
+    0.5504579729366048, 0.5507780983539122, 0.5510981427690754, 0.5514181061350261,
+    0.5517379884047074, 0.552057789531075, 0.5523775094670961, 0.5526971481657498,
+    0.5530167055800276, 0.5533361816629323, 0.5536555763674793, 0.5539748896466955,
+    0.5542941214536201, 0.554613271741304, 0.5549323404628104, 0.5552513275712141,
+    0.5555702330196022, 0.5558890567610738, 0.5562077987487399, 0.5565264589357237,
+    0.5568450372751601, 0.5571635337201963, 0.5574819482239916, 0.5578002807397171,
+    0.5581185312205561, 0.5584366996197041, 0.5587547858903683, 0.5590727899857685,
+    0.559390711859136, 0.5597085514637148, 0.5600263087527604, 0.5603439836795407,
+    0.560661576197336, 0.5609790862594382, 0.5612965138191515, 0.5616138588297924,
+    0.5619311212446895, 0.5622483010171831, 0.5625653981006266, 0.5628824124483844,
+    0.5631993440138341, 0.5635161927503648, 0.5638329586113782, 0.5641496415502877,
+    0.5644662415205195, 0.5647827584755114, 0.565099192368714, 0.5654155431535897,
+    0.5657318107836132, 0.5660479952122716, 0.5663640963930638, 0.5666801142795017,
+    0.5669960488251087, 0.5673118999834208, 0.5676276677079862, 0.5679433519523656,
+    0.5682589526701316, 0.5685744698148691, 0.5688899033401759, 0.5692052531996612,
+    0.5695205193469471, 0.569835701735668, 0.5701508003194703, 0.570465815052013,
+    0.5707807458869673, 0.5710955927780167, 0.5714103556788572, 0.5717250345431971,
+    0.572039629324757, 0.5723541399772699, 0.5726685664544813, 0.5729829087101486,
+    0.5732971666980422, 0.5736113403719446, 0.5739254296856507, 0.5742394345929679,
+    0.5745533550477158, 0.5748671910037267, 0.5751809424148452, 0.5754946092349282,
+    0.5758081914178453, 0.5761216889174784, 0.5764351016877218, 0.5767484296824824,
+    0.5770616728556796, 0.5773748311612449, 0.5776879045531228, 0.5780008929852699,
+    0.5783137964116556, 0.5786266147862614, 0.5789393480630819, 0.5792519961961236,
+    0.5795645591394057, 0.5798770368469603, 0.5801894292728317, 0.5805017363710766,
+    0.5808139580957645, 0.5811260944009776, 0.5814381452408103, 0.5817501105693696,
+    0.5820619903407755, 0.5823737845091601, 0.5826854930286685, 0.5829971158534578,
+    0.5833086529376983, 0.5836201042355726, 0.5839314697012763, 0.584242749289017,
+    0.5845539429530153, 0.5848650506475045, 0.5851760723267304, 0.5854870079449515,
+    0.5857978574564389, 0.5861086208154764, 0.5864192979763605, 0.5867298888934005,
+    0.587040393520918, 0.5873508118132477, 0.5876611437247367, 0.587971389209745,
+    0.5882815482226453, 0.5885916207178229, 0.5889016066496758, 0.589211505972615,
+    0.5895213186410639, 0.5898310446094589, 0.5901406838322489, 0.5904502362638958,
+    0.5907597018588743, 0.5910690805716714, 0.5913783723567876, 0.5916875771687355,
+    0.591996694962041, 0.5923057256912424, 0.5926146693108911, 0.5929235257755513,
+    0.5932322950397998, 0.5935409770582264, 0.5938495717854336, 0.5941580791760368,
+    0.5944664991846644, 0.5947748317659575, 0.59508307687457, 0.5953912344651687,
+    0.5956993044924334, 0.5960072869110565, 0.5963151816757437, 0.5966229887412133,
+    0.5969307080621965, 0.5972383395934374, 0.5975458832896933, 0.5978533391057339,
+    0.5981607069963423, 0.5984679869163143, 0.5987751788204587, 0.5990822826635972,
+    0.5993892984005645, 0.5996962259862083, 0.600003065375389, 0.6003098165229804,
+    0.600616479383869, 0.6009230539129541, 0.6012295400651485, 0.6015359377953776,
+    0.60184224705858, 0.6021484678097072, 0.6024546000037238, 0.6027606435956072,
+    0.6030665985403482, 0.6033724647929504, 0.6036782423084304, 0.603983931041818,
+    0.6042895309481561, 0.6045950419825004, 0.6049004640999198, 0.6052057972554965,
+    0.6055110414043255, 0.605816196501515, 0.6061212625021862, 0.6064262393614736,
+    0.6067311270345245, 0.6070359254764996, 0.6073406346425728, 0.6076452544879308,
+    0.6079497849677736, 0.6082542260373144, 0.6085585776517795, 0.6088628397664082,
+    0.6091670123364532, 0.6094710953171802, 0.6097750886638684, 0.6100789923318096,
+    0.6103828062763095, 0.6106865304526863, 0.6109901648162718, 0.6112937093224109,
+    0.6115971639264619, 0.6119005285837961, 0.612203803249798, 0.6125069878798655,
+    0.6128100824294097, 0.6131130868538549, 0.6134160011086386, 0.6137188251492117,
+    0.6140215589310384, 0.614324202409596, 0.614626755540375, 0.6149292182788796,
+    0.6152315905806268, 0.6155338724011474, 0.615836063695985, 0.6161381644206969,
+    0.6164401745308536, 0.6167420939820388, 0.6170439227298498, 0.6173456607298968,
+    0.617647307937804, 0.6179488643092083, 0.6182503297997602, 0.6185517043651239,
+    0.6188529879609763, 0.6191541805430084, 0.619455282066924, 0.6197562924884407,
+    0.6200572117632892, 0.6203580398472138, 0.6206587766959721, 0.6209594222653352,
+    0.6212599765110877, 0.6215604393890272, 0.6218608108549654, 0.6221610908647268,
+    0.62246127937415, 0.6227613763390863, 0.6230613817154013, 0.6233612954589733,
+    0.6236611175256945, 0.6239608478714707, 0.6242604864522208, 0.6245600332238772,
+    0.6248594881423863, 0.6251588511637077, 0.6254581222438144, 0.6257573013386929,
+    0.6260563884043435, 0.62635538339678, 0.6266542862720295, 0.6269530969861327,
+    0.6272518154951441, 0.6275504417551315, 0.6278489757221766, 0.628147417352374,
+    0.6284457666018327, 0.6287440234266748, 0.6290421877830359, 0.6293402596270657,
+    0.629638238914927, 0.6299361256027965, 0.6302339196468645, 0.6305316210033346,
+    0.6308292296284246, 0.6311267454783653, 0.6314241685094018, 0.6317214986777924,
+    0.6320187359398091, 0.6323158802517376, 0.6326129315698775, 0.6329098898505418,
+    0.6332067550500573, 0.6335035271247643, 0.6338002060310173, 0.6340967917251837,
+    0.6343932841636455, 0.6346896833027977, 0.6349859890990495, 0.6352822015088234,
+    0.6355783204885561, 0.6358743459946977, 0.6361702779837122, 0.6364661164120772,
+    0.6367618612362842, 0.6370575124128386, 0.6373530698982591, 0.6376485336490788,
+    0.637943903621844, 0.6382391797731154, 0.6385343620594668, 0.6388294504374863,
+    0.6391244448637757, 0.6394193452949507, 0.6397141516876405, 0.6400088639984884,
+    0.6403034821841517, 0.640598006201301, 0.6408924360066214, 0.6411867715568113,
+    0.6414810128085832, 0.6417751597186635, 0.6420692122437925, 0.6423631703407243,
+    0.6426570339662269, 0.6429508030770821, 0.6432444776300859, 0.6435380575820477,
+    0.6438315428897915, 0.6441249335101545, 0.6444182293999884, 0.6447114305161584,
+    0.6450045368155439, 0.6452975482550384, 0.6455904647915487, 0.6458832863819963,
+    0.6461760129833164, 0.6464686445524579, 0.6467611810463839, 0.6470536224220717,
+    0.6473459686365121, 0.6476382196467103, 0.6479303754096855, 0.6482224358824704,
+    0.6485144010221124, 0.6488062707856725, 0.649098045130226, 0.6493897240128618,
+    0.6496813073906832, 0.6499727952208075, 0.650264187460366, 0.650555484066504,
+    0.6508466849963809, 0.6511377902071703, 0.6514287996560598, 0.6517197133002509,
+    0.6520105310969595, 0.6523012530034155, 0.6525918789768625, 0.652882408974559,
+    0.6531728429537768, 0.6534631808718023, 0.6537534226859362, 0.6540435683534926,
+    0.6543336178318006, 0.6546235710782027, 0.654913428050056, 0.6552031887047318,
+    0.6554928529996153, 0.6557824208921061, 0.6560718923396177, 0.656361267299578,
+    0.656650545729429, 0.6569397275866271, 0.6572288128286425, 0.6575178014129601,
+    0.6578066932970786, 0.6580954884385112, 0.658384186794785, 0.6586727883234419,
+    0.6589612929820373, 0.6592497007281415, 0.6595380115193387, 0.6598262253132274,
+    0.6601143420674205, 0.660402361739545, 0.6606902842872423, 0.6609781096681681,
+    0.6612658378399923, 0.661553468760399, 0.6618410023870869, 0.6621284386777687,
+    0.6624157775901718, 0.6627030190820374, 0.6629901631111215, 0.6632772096351941,
+    0.6635641586120398, 0.6638510099994573, 0.66413776375526, 0.6644244198372752,
+    0.6647109782033449, 0.6649974388113253, 0.6652838016190872, 0.6655700665845155,
+    0.6658562336655097, 0.6661423028199835, 0.6664282740058654, 0.6667141471810977,
+    0.6669999223036375, 0.6672855993314565, 0.6675711782225403, 0.6678566589348894,
+    0.6681420414265186, 0.6684273256554568, 0.6687125115797481, 0.6689975991574503,
+    0.6692825883466361, 0.6695674791053925, 0.669852271391821, 0.6701369651640378,
+    0.6704215603801731, 0.6707060569983722, 0.6709904549767942, 0.6712747542736135,
+    0.6715589548470184, 0.6718430566552119, 0.6721270596564117, 0.6724109638088499,
+    0.672694769070773, 0.6729784754004421, 0.673262082756133, 0.6735455910961361,
+    0.673829000378756, 0.6741123105623124, 0.674395521605139, 0.6746786334655845,
+    0.674961646102012, 0.6752445594727993, 0.6755273735363386, 0.6758100882510369,
+    0.6760927035753159, 0.6763752194676117, 0.676657635886375, 0.6769399527900711,
+    0.6772221701371804, 0.6775042878861974, 0.6777863059956315, 0.6780682244240066,
+    0.6783500431298615, 0.6786317620717495, 0.6789133812082384, 0.6791949004979112,
+    0.6794763198993651, 0.679757639371212, 0.6800388588720789, 0.6803199783606072,
+    0.680600997795453, 0.6808819171352872, 0.6811627363387954, 0.6814434553646779,
+    0.6817240741716498, 0.6820045927184408, 0.6822850109637956, 0.6825653288664733,
+    0.6828455463852481, 0.6831256634789087, 0.6834056801062588, 0.6836855962261167,
+    0.6839654117973154, 0.6842451267787031, 0.6845247411291423, 0.6848042548075106,
+    0.6850836677727004, 0.6853629799836187, 0.6856421913991875, 0.6859213019783436,
+    0.6862003116800386, 0.686479220463239, 0.6867580282869259, 0.6870367351100957,
+    0.6873153408917592, 0.6875938455909422, 0.6878722491666855, 0.6881505515780448,
+    0.6884287527840904, 0.6887068527439077, 0.688984851416597, 0.6892627487612735,
+    0.6895405447370669, 0.6898182393031225, 0.6900958324186, 0.690373324042674,
+    0.6906507141345346, 0.6909280026533863, 0.6912051895584485, 0.6914822748089559,
+    0.6917592583641577, 0.6920361401833187, 0.6923129202257182, 0.6925895984506504,
+    0.6928661748174246, 0.6931426492853654, 0.6934190218138119, 0.6936952923621182,
+    0.693971460889654, 0.6942475273558033, 0.6945234917199655, 0.6947993539415549,
+    0.6950751139800009, 0.6953507717947477, 0.6956263273452549, 0.6959017805909968,
+    0.696177131491463, 0.6964523800061578, 0.6967275260946012, 0.6970025697163275,
+    0.6972775108308865, 0.6975523493978432, 0.6978270853767773, 0.6981017187272839,
+    0.6983762494089728, 0.6986506773814696, 0.6989250026044141, 0.699199225037462,
+    0.6994733446402838, 0.699747361372565, 0.7000212751940064, 0.7002950860643238,
+    0.7005687939432483, 0.7008423987905262, 0.7011159005659187, 0.7013892992292022,
+    0.7016625947401685, 0.7019357870586244, 0.7022088761443919, 0.702481861957308,
+    0.7027547444572253, 0.7030275236040113, 0.7033001993575487, 0.7035727716777356,
+    0.7038452405244849, 0.7041176058577254, 0.7043898676374004, 0.7046620258234689,
+    0.7049340803759049, 0.7052060312546978, 0.7054778784198522, 0.7057496218313878,
+    0.7060212614493397, 0.7062927972337585, 0.7065642291447095, 0.7068355571422739,
+    0.7071067811865476, 0.7073779012376421, 0.7076489172556844, 0.7079198292008163,
+    0.7081906370331953, 0.708461340712994, 0.7087319402004006, 0.7090024354556183,
+    0.7092728264388657, 0.7095431131103768, 0.7098132954304008, 0.7100833733592027,
+    0.7103533468570623, 0.710623215884275, 0.7108929804011517, 0.7111626403680184,
+    0.7114321957452164, 0.711701646493103, 0.7119709925720501, 0.7122402339424455,
+    0.7125093705646923, 0.712778402399209, 0.7130473294064292, 0.7133161515468026,
+    0.7135848687807936, 0.7138534810688825, 0.7141219883715647, 0.7143903906493514,
+    0.7146586878627691, 0.7149268799723595, 0.7151949669386801, 0.7154629487223036,
+    0.7157308252838187, 0.7159985965838287, 0.7162662625829531, 0.7165338232418267,
+    0.7168012785210995, 0.7170686283814375, 0.7173358727835217, 0.7176030116880491,
+    0.7178700450557317, 0.7181369728472975, 0.7184037950234897, 0.7186705115450672,
+    0.7189371223728045, 0.7192036274674912, 0.719470026789933, 0.719736320300951,
+    0.7200025079613817, 0.7202685897320771, 0.7205345655739053, 0.7208004354477493,
+    0.7210661993145081, 0.7213318571350962, 0.7215974088704438, 0.7218628544814963,
+    0.7221281939292153, 0.7223934271745776, 0.7226585541785756, 0.7229235749022177,
+    0.7231884893065275, 0.7234532973525444, 0.7237179990013235, 0.7239825942139355,
+    0.7242470829514669, 0.7245114651750196, 0.7247757408457113, 0.7250399099246753,
+    0.7253039723730608, 0.7255679281520323, 0.7258317772227703, 0.7260955195464709,
+    0.726359155084346, 0.726622683797623, 0.726886105647545, 0.727149420595371,
+    0.7274126286023758, 0.7276757296298496, 0.7279387236390986, 0.7282016105914446,
+    0.7284643904482252, 0.7287270631707937, 0.7289896287205194, 0.729252087058787,
+    0.729514438146997, 0.7297766819465661, 0.7300388184189261, 0.7303008475255255,
+    0.7305627692278276, 0.730824583487312, 0.7310862902654743, 0.7313478895238255,
+    0.7316093812238925, 0.7318707653272183, 0.7321320417953613, 0.732393210589896,
+    0.7326542716724128, 0.7329152250045178, 0.7331760705478327, 0.7334368082639957,
+    0.7336974381146603, 0.7339579600614959, 0.7342183740661883, 0.7344786800904384,
+    0.7347388780959635, 0.7349989680444966, 0.7352589498977868, 0.7355188236175989,
+    0.7357785891657135, 0.7360382465039275, 0.7362977955940532, 0.7365572363979191,
+    0.7368165688773699, 0.7370757929942656, 0.7373349087104828, 0.7375939159879136,
+    0.737852814788466, 0.7381116050740643, 0.7383702868066486, 0.7386288599481748,
+    0.7388873244606151, 0.7391456803059574, 0.7394039274462058, 0.73966206584338,
+    0.7399200954595162, 0.7401780162566661, 0.740435828196898, 0.7406935312422956,
+    0.7409511253549591, 0.7412086104970043, 0.7414659866305633, 0.7417232537177841,
+    0.7419804117208311, 0.742237460601884, 0.7424944003231392, 0.742751230846809,
+    0.7430079521351217, 0.7432645641503216, 0.7435210668546691, 0.7437774602104408,
+    0.7440337441799293, 0.7442899187254431, 0.7445459838093074, 0.7448019393938626,
+    0.745057785441466, 0.7453135219144905, 0.7455691487753254, 0.745824665986376,
+    0.7460800735100638, 0.7463353713088263, 0.7465905593451172, 0.7468456375814065,
+    0.7471006059801801, 0.7473554645039403, 0.7476102131152051, 0.7478648517765094,
+    0.7481193804504036, 0.7483737990994546, 0.7486281076862453, 0.7488823061733751,
+    0.7491363945234594, 0.7493903726991296, 0.7496442406630335, 0.7498979983778352,
+    0.7501516458062151, 0.7504051829108693, 0.7506586096545106, 0.750911925999868,
+    0.7511651319096864, 0.7514182273467274, 0.7516712122737684, 0.7519240866536036,
+    0.7521768504490427, 0.7524295036229124, 0.7526820461380552, 0.7529344779573303,
+    0.7531867990436125, 0.7534390093597936, 0.7536911088687813, 0.7539430975334996,
+    0.7541949753168892, 0.7544467421819064, 0.7546983980915244, 0.7549499430087326,
+    0.7552013768965365, 0.7554526997179581, 0.7557039114360359, 0.7559550120138243,
+    0.7562060014143945, 0.7564568796008337, 0.7567076465362457, 0.7569583021837505,
+    0.7572088465064846, 0.7574592794676007, 0.7577096010302681, 0.7579598111576723,
+    0.7582099098130153, 0.7584598969595154, 0.7587097725604074, 0.7589595365789424,
+    0.7592091889783881, 0.7594587297220282, 0.7597081587731634, 0.7599574760951103,
+    0.7602066816512024, 0.7604557754047893, 0.7607047573192369, 0.7609536273579282,
+    0.7612023854842618, 0.7614510316616535, 0.7616995658535353, 0.7619479880233554,
+    0.7621962981345789, 0.7624444961506871, 0.762692582035178, 0.7629405557515657,
+    0.7631884172633813, 0.763436166534172, 0.7636838035275019, 0.7639313282069511,
+    0.7641787405361167, 0.7644260404786121, 0.7646732279980671, 0.7649203030581284,
+    0.765167265622459, 0.7654141156547383, 0.7656608531186625, 0.7659074779779442,
+    0.7661539901963129, 0.7664003897375141, 0.7666466765653105, 0.7668928506434807,
+    0.7671389119358204, 0.7673848604061417, 0.7676306960182734, 0.7678764187360606,
+    0.7681220285233654, 0.7683675253440663, 0.7686129091620583, 0.7688581799412533,
+    0.7691033376455796, 0.7693483822389823, 0.7695933136854229, 0.7698381319488798,
+    0.770082836993348, 0.7703274287828389, 0.7705719072813807, 0.7708162724530185,
+    0.7710605242618138, 0.7713046626718447, 0.7715486876472063, 0.7717925991520102,
+    0.7720363971503845, 0.7722800816064743, 0.7725236524844413, 0.7727671097484639,
+    0.773010453362737, 0.7732536832914726, 0.773496799498899, 0.7737398019492618,
+    0.7739826906068228, 0.7742254654358607, 0.7744681264006709, 0.7747106734655657,
+    0.7749531065948739, 0.7751954257529413, 0.7754376309041305, 0.7756797220128206,
+    0.7759216990434076, 0.7761635619603043, 0.7764053107279404, 0.7766469453107621,
+    0.7768884656732324, 0.7771298717798316, 0.7773711635950563, 0.7776123410834199,
+    0.777853404209453, 0.7780943529377028, 0.7783351872327332, 0.7785759070591249,
+    0.778816512381476, 0.7790570031644006, 0.7792973793725303, 0.7795376409705133,
+    0.7797777879230144, 0.780017820194716, 0.7802577377503166, 0.7804975405545319,
+    0.7807372285720945, 0.7809768017677537, 0.7812162601062761, 0.7814556035524446,
+    0.7816948320710594, 0.7819339456269375, 0.782172944184913, 0.7824118277098364,
+    0.7826505961665757, 0.7828892495200155, 0.7831277877350573, 0.7833662107766197,
+    0.7836045186096382, 0.7838427111990652, 0.78408078850987, 0.7843187505070389,
+    0.7845565971555752, 0.7847943284204992, 0.7850319442668481, 0.785269444659676,
+    0.7855068295640539, 0.7857440989450704, 0.7859812527678302, 0.7862182909974557,
+    0.7864552135990858, 0.7866920205378768, 0.7869287117790018, 0.7871652872876509,
+    0.7874017470290314, 0.7876380909683675, 0.7878743190709002, 0.7881104313018881,
+    0.7883464276266062, 0.7885823080103472, 0.7888180724184203, 0.7890537208161519,
+    0.7892892531688857, 0.7895246694419822, 0.7897599696008191, 0.7899951536107911,
+    0.79023022143731, 0.7904651730458049, 0.7907000084017216, 0.7909347274705233,
+    0.7911693302176902, 0.7914038166087195, 0.7916381866091258, 0.7918724401844405,
+    0.7921065773002124, 0.7923405979220071, 0.7925745020154077, 0.7928082895460141,
+    0.7930419604794436, 0.7932755147813306, 0.7935089524173267, 0.7937422733531002,
+    0.7939754775543372, 0.7942085649867406, 0.7944415356160306, 0.7946743894079445,
+    0.794907126328237, 0.7951397463426796, 0.7953722494170613, 0.7956046355171882,
+    0.7958369046088836, 0.796069056657988, 0.7963010916303591, 0.796533009491872,
+    0.7967648102084187, 0.7969964937459088, 0.7972280600702687, 0.7974595091474425,
+    0.7976908409433912, 0.797922055424093, 0.7981531525555439, 0.7983841323037564,
+    0.7986149946347608, 0.7988457395146046, 0.7990763669093524, 0.7993068767850862,
+    0.799537269107905, 0.7997675438439257, 0.7999977009592819, 0.8002277404201248,
+    0.8004576621926228, 0.8006874662429616, 0.8009171525373443, 0.8011467210419912,
+    0.8013761717231402, 0.8016055045470462, 0.8018347194799813, 0.8020638164882355,
+    0.8022927955381157, 0.8025216565959463, 0.8027503996280692, 0.8029790246008431,
+    0.8032075314806449, 0.8034359202338681, 0.8036641908269241, 0.8038923432262413,
+    0.8041203773982657, 0.8043482933094608, 0.8045760909263071, 0.8048037702153028,
+    0.8050313311429635, 0.8052587736758222, 0.8054860977804291, 0.8057133034233521,
+    0.8059403905711763, 0.8061673591905044, 0.8063942092479564, 0.8066209407101697,
+    0.8068475535437992, 0.8070740477155176, 0.8073004231920144, 0.8075266799399972,
+    0.8077528179261904, 0.8079788371173363, 0.8082047374801947, 0.8084305189815427,
+    0.808656181588175, 0.8088817252669036, 0.8091071499845582, 0.8093324557079858,
+    0.8095576424040513, 0.8097827100396364, 0.8100076585816411, 0.8102324879969823,
+    0.8104571982525948, 0.8106817893154307, 0.8109062611524597, 0.8111306137306692,
+    0.8113548470170637, 0.8115789609786659, 0.8118029555825154, 0.8120268307956697,
+    0.8122505865852039, 0.8124742229182105, 0.8126977397617995, 0.8129211370830988,
+    0.8131444148492535, 0.8133675730274266, 0.8135906115847985, 0.8138135304885672,
+    0.8140363297059484, 0.8142590092041753, 0.8144815689504986, 0.8147040089121871,
+    0.8149263290565266, 0.8151485293508209, 0.8153706097623913, 0.8155925702585767,
+    0.8158144108067338, 0.8160361313742367, 0.8162577319284774, 0.8164792124368654,
+    0.8167005728668278, 0.8169218131858095, 0.817142933361273, 0.8173639333606985,
+    0.8175848131515837, 0.8178055727014443, 0.8180262119778134, 0.8182467309482421,
+    0.8184671295802987, 0.8186874078415697, 0.818907565699659, 0.8191276031221882,
+    0.819347520076797, 0.8195673165311422, 0.819786992452899, 0.8200065478097597,
+    0.8202259825694347, 0.820445296699652, 0.8206644901681575, 0.8208835629427146,
+    0.8211025149911046, 0.8213213462811267, 0.8215400567805976, 0.8217586464573517,
+    0.8219771152792416, 0.8221954632141372, 0.8224136902299264, 0.822631796294515,
+    0.8228497813758263, 0.8230676454418017, 0.8232853884604001, 0.8235030103995985,
+    0.8237205112273914, 0.8239378909117914, 0.8241551494208286, 0.8243722867225513,
+    0.8245893027850253, 0.8248061975763343, 0.8250229710645802, 0.8252396232178821,
+    0.8254561540043776, 0.8256725633922214, 0.8258888513495869, 0.8261050178446646,
+    0.8263210628456635, 0.82653698632081, 0.8267527882383485, 0.8269684685665415,
+    0.8271840272736691, 0.8273994643280294, 0.8276147796979384, 0.8278299733517299,
+    0.8280450452577558, 0.8282599953843857, 0.8284748237000071, 0.8286895301730257,
+    0.8289041147718649, 0.829118577464966, 0.8293329182207883, 0.8295471370078089,
+    0.829761233794523, 0.8299752085494438, 0.8301890612411024, 0.8304027918380475,
+    0.8306164003088463, 0.8308298866220836, 0.8310432507463623, 0.8312564926503032,
+    0.8314696123025452, 0.8316826096717451, 0.8318954847265776, 0.8321082374357356,
+    0.8323208677679297, 0.8325333756918887, 0.8327457611763595, 0.8329580241901067,
+    0.8331701647019132, 0.8333821826805797, 0.8335940780949251, 0.8338058509137863,
+    0.8340175011060181, 0.8342290286404934, 0.8344404334861032, 0.8346517156117563,
+    0.83486287498638, 0.8350739115789193, 0.8352848253583374, 0.8354956162936154,
+    0.8357062843537526, 0.8359168295077664, 0.8361272517246922, 0.8363375509735835,
+    0.836547727223512, 0.8367577804435672, 0.836967710602857, 0.8371775176705073,
+    0.8373872016156619, 0.837596762407483, 0.8378062000151509, 0.8380155144078637,
+    0.8382247055548381, 0.8384337734253083, 0.8386427179885273, 0.8388515392137658,
+    0.8390602370703127, 0.8392688115274752, 0.8394772625545786, 0.8396855901209661,
+    0.8398937941959995, 0.8401018747490584, 0.8403098317495408, 0.8405176651668625,
+    0.8407253749704581, 0.8409329611297797, 0.8411404236142981, 0.841347762393502,
+    0.8415549774368984, 0.8417620687140125, 0.8419690361943877, 0.8421758798475856,
+    0.8423825996431858, 0.8425891955507867, 0.8427956675400042, 0.8430020155804728,
+    0.8432082396418454, 0.8434143396937928, 0.843620315706004, 0.8438261676481867,
+    0.8440318954900664, 0.844237499201387, 0.8444429787519107, 0.8446483341114178,
+    0.8448535652497071, 0.8450586721365955, 0.8452636547419182, 0.8454685130355288,
+    0.8456732469872991, 0.845877856567119, 0.8460823417448969, 0.8462867024905597,
+    0.8464909387740521, 0.8466950505653374, 0.8468990378343972, 0.8471029005512315,
+    0.8473066386858584, 0.8475102522083143, 0.8477137410886543, 0.8479171052969514,
+    0.8481203448032972, 0.8483234595778016, 0.8485264495905926, 0.848729314811817,
+    0.8489320552116396, 0.8491346707602436, 0.8493371614278308, 0.8495395271846209,
+    0.8497417680008524, 0.8499438838467822, 0.8501458746926852, 0.850347740508855,
+    0.8505494812656035, 0.8507510969332608, 0.8509525874821757, 0.8511539528827153,
+    0.8513551931052652, 0.851556308120229, 0.8517572978980291, 0.8519581624091064,
+    0.8521589016239198, 0.8523595155129471, 0.8525600040466841, 0.8527603671956453,
+    0.8529606049303636, 0.8531607172213904, 0.8533607040392954, 0.8535605653546668,
+    0.8537603011381114, 0.8539599113602542, 0.8541593959917388, 0.8543587550032274,
+    0.8545579883654005, 0.8547570960489572, 0.8549560780246149, 0.8551549342631096,
+    0.855353664735196, 0.855552269411647, 0.8557507482632539, 0.8559491012608269,
+    0.8561473283751945, 0.8563454295772036, 0.85654340483772, 0.8567412541276275,
+    0.8569389774178288, 0.8571365746792449, 0.8573340458828156, 0.8575313909994992,
+    0.8577286100002721, 0.8579257028561298, 0.8581226695380861, 0.8583195100171734,
+    0.8585162242644427, 0.8587128122509635, 0.8589092739478239, 0.8591056093261304,
+    0.8593018183570084, 0.8594979010116017, 0.8596938572610726, 0.8598896870766023,
+    0.8600853904293901, 0.8602809672906545, 0.8604764176316321, 0.8606717414235784,
+    0.8608669386377673, 0.8610620092454915, 0.8612569532180622, 0.8614517705268093,
+    0.8616464611430813, 0.8618410250382453, 0.8620354621836872, 0.8622297725508112,
+    0.8624239561110405, 0.8626180128358167, 0.8628119426966003, 0.8630057456648703,
+    0.8631994217121242, 0.8633929708098784, 0.863586392929668, 0.8637796880430467,
+    0.8639728561215867, 0.8641658971368793, 0.864358811060534, 0.8645515978641793,
+    0.8647442575194624, 0.864936789998049, 0.8651291952716237, 0.8653214733118898,
+    0.8655136240905691, 0.8657056475794023, 0.8658975437501488, 0.8660893125745868,
+    0.866280954024513, 0.866472468071743, 0.8666638546881111, 0.8668551138454704,
+    0.8670462455156926, 0.8672372496706684, 0.8674281262823069, 0.8676188753225362,
+    0.8678094967633032, 0.8679999905765735, 0.8681903567343313, 0.8683805952085798,
+    0.8685707059713409, 0.8687606889946553, 0.8689505442505824, 0.8691402717112006,
+    0.8693298713486067, 0.8695193431349169, 0.8697086870422656, 0.8698979030428063,
+    0.8700869911087115, 0.8702759512121719, 0.8704647833253977, 0.8706534874206174,
+    0.8708420634700789, 0.8710305114460484, 0.871218831320811, 0.871407023066671,
+    0.8715950866559511, 0.8717830220609931, 0.8719708292541578, 0.8721585082078245,
+    0.8723460588943915, 0.8725334812862761, 0.8727207753559143, 0.872907941075761,
+    0.8730949784182901, 0.8732818873559942, 0.8734686678613849, 0.8736553199069926,
+    0.8738418434653669, 0.8740282385090756, 0.8742145050107063, 0.8744006429428648,
+    0.8745866522781761, 0.8747725329892841, 0.8749582850488516, 0.8751439084295604,
+    0.8753294031041109, 0.8755147690452227, 0.8757000062256346, 0.8758851146181037,
+    0.8760700941954066, 0.8762549449303385, 0.8764396667957136, 0.8766242597643653,
+    0.8768087238091457, 0.8769930589029259, 0.877177265018596, 0.8773613421290651,
+    0.8775452902072612, 0.8777291092261316, 0.8779127991586418, 0.8780963599777771,
+    0.8782797916565415, 0.8784630941679579, 0.8786462674850681, 0.8788293115809334,
+    0.8790122264286335, 0.8791950120012675, 0.8793776682719533, 0.8795601952138279,
+    0.8797425928000474, 0.8799248610037869, 0.8801069997982404, 0.8802890091566209,
+    0.8804708890521608, 0.880652639458111, 0.880834260347742, 0.8810157516943429,
+    0.881197113471222, 0.8813783456517068, 0.8815594482091438, 0.8817404211168983,
+    0.881921264348355, 0.8821019778769176, 0.8822825616760087, 0.8824630157190702,
+    0.8826433399795628, 0.8828235344309666, 0.8830035990467808, 0.8831835338005234,
+    0.8833633386657316, 0.8835430136159619, 0.8837225586247897, 0.8839019736658095,
+    0.884081258712635, 0.8842604137388991, 0.8844394387182537, 0.8846183336243699,
+    0.8847970984309378, 0.8849757331116667, 0.8851542376402851, 0.8853326119905406,
+    0.8855108561362, 0.885688970051049, 0.8858669537088928, 0.8860448070835556,
+    0.8862225301488806, 0.8864001228787306, 0.886577585246987, 0.8867549172275508,
+    0.8869321187943422, 0.8871091899213002, 0.8872861305823831, 0.8874629407515688,
+    0.8876396204028539, 0.8878161695102544, 0.8879925880478056, 0.8881688759895616,
+    0.8883450333095964, 0.8885210599820023, 0.8886969559808916, 0.8888727212803956,
+    0.8890483558546646, 0.8892238596778682, 0.8893992327241955, 0.8895744749678546,
+    0.8897495863830728, 0.8899245669440967, 0.8900994166251923, 0.8902741354006446,
+    0.8904487232447579, 0.8906231801318559, 0.8907975060362815, 0.8909717009323969,
+    0.8911457647945832, 0.8913196975972414, 0.8914934993147914, 0.8916671699216723,
+    0.8918407093923427, 0.8920141177012805, 0.8921873948229825, 0.8923605407319654,
+    0.8925335554027646, 0.8927064388099353, 0.8928791909280517, 0.8930518117317074,
+    0.8932243011955153, 0.8933966592941076, 0.8935688860021359, 0.893740981294271,
+    0.8939129451452033, 0.894084777529642, 0.894256478422316, 0.8944280477979738,
+    0.8945994856313827, 0.8947707918973296, 0.8949419665706208, 0.8951130096260818,
+    0.8952839210385575, 0.8954547007829124, 0.8956253488340301, 0.8957958651668135,
+    0.8959662497561851, 0.8961365025770868, 0.8963066236044795, 0.8964766128133441,
+    0.8966464701786802, 0.8968161956755073, 0.896985789278864, 0.8971552509638084,
+    0.8973245807054183, 0.8974937784787903, 0.8976628442590409, 0.8978317780213056,
+    0.8980005797407399, 0.8981692493925181, 0.8983377869518343, 0.898506192393902,
+    0.8986744656939538, 0.8988426068272423, 0.8990106157690391, 0.8991784924946353,
+    0.8993462369793416, 0.899513849198488, 0.8996813291274239, 0.8998486767415186,
+    0.9000158920161603, 0.9001829749267568, 0.9003499254487356, 0.9005167435575435,
+    0.9006834292286469, 0.9008499824375314, 0.9010164031597023, 0.9011826913706845,
+    0.901348847046022, 0.9015148701612787, 0.9016807606920377, 0.9018465186139017,
+    0.9020121439024932, 0.9021776365334536, 0.9023429964824442, 0.9025082237251458,
+    0.9026733182372588, 0.9028382799945028, 0.9030031089726172, 0.9031678051473607,
+    0.9033323684945118, 0.9034967989898685, 0.903661096609248, 0.9038252613284874,
+    0.9039892931234433, 0.9041531919699918, 0.9043169578440283, 0.9044805907214682,
+    0.9046440905782462, 0.9048074573903165, 0.9049706911336532, 0.9051337917842497,
+    0.9052967593181188, 0.9054595937112933, 0.9056222949398253, 0.9057848629797866,
+    0.9059472978072685, 0.906109599398382, 0.9062717677292575, 0.9064338027760455,
+    0.9065957045149153, 0.9067574729220566, 0.9069191079736781, 0.9070806096460085,
+    0.9072419779152958, 0.9074032127578081, 0.9075643141498326, 0.9077252820676764,
+    0.9078861164876663, 0.9080468173861483, 0.9082073847394887, 0.9083678185240729,
+    0.9085281187163061, 0.9086882852926134, 0.9088483182294391, 0.9090082175032475,
+    0.9091679830905224, 0.9093276149677673, 0.9094871131115054, 0.9096464774982795,
+    0.9098057081046522, 0.9099648049072057, 0.9101237678825417, 0.9102825970072818,
+    0.9104412922580672, 0.9105998536115589, 0.9107582810444376, 0.9109165745334034,
+    0.9110747340551764, 0.9112327595864962, 0.9113906511041223, 0.911548408584834,
+    0.9117060320054299, 0.9118635213427285, 0.9120208765735683, 0.9121780976748072,
+    0.9123351846233227, 0.9124921373960126, 0.9126489559697939, 0.9128056403216035,
+    0.9129621904283982, 0.9131186062671541, 0.9132748878148678, 0.9134310350485547,
+    0.9135870479452508, 0.9137429264820114, 0.9138986706359117, 0.9140542803840465,
+    0.9142097557035307, 0.9143650965714986, 0.9145203029651044, 0.9146753748615224,
+    0.9148303122379462, 0.9149851150715893, 0.9151397833396853, 0.915294317019487,
+    0.9154487160882678, 0.9156029805233202, 0.9157571103019567, 0.9159111054015099,
+    0.9160649657993317, 0.9162186914727942, 0.9163722823992891, 0.9165257385562282,
+    0.9166790599210427, 0.9168322464711839, 0.916985298184123, 0.9171382150373507,
+    0.9172909970083779, 0.9174436440747352, 0.9175961562139728, 0.9177485334036612,
+    0.9179007756213905, 0.9180528828447704, 0.9182048550514309, 0.9183566922190217,
+    0.9185083943252123, 0.9186599613476919, 0.9188113932641699, 0.9189626900523756,
+    0.9191138516900578, 0.9192648781549853, 0.919415769424947, 0.9195665254777515,
+    0.9197171462912274, 0.919867631843223, 0.9200179821116066, 0.9201681970742663,
+    0.9203182767091106, 0.9204682209940671, 0.9206180299070839, 0.9207677034261288,
+    0.9209172415291894, 0.9210666441942736, 0.9212159113994087, 0.9213650431226423,
+    0.9215140393420419, 0.9216629000356947, 0.9218116251817081, 0.9219602147582092,
+    0.9221086687433451, 0.922256987115283, 0.9224051698522099, 0.9225532169323328,
+    0.9227011283338785, 0.9228489040350941, 0.9229965440142462, 0.9231440482496219,
+    0.9232914167195276, 0.9234386494022904, 0.9235857462762567, 0.9237327073197932,
+    0.9238795325112867, 0.9240262218291438, 0.9241727752517911, 0.9243191927576752,
+    0.9244654743252626, 0.92461161993304, 0.9247576295595139, 0.9249035031832109,
+    0.9250492407826776, 0.9251948423364805, 0.9253403078232063, 0.9254856372214615,
+    0.9256308305098727, 0.9257758876670867, 0.92592080867177, 0.9260655935026093,
+    0.9262102421383114, 0.9263547545576029, 0.9264991307392305, 0.9266433706619612,
+    0.9267874743045817, 0.9269314416458991, 0.9270752726647401, 0.9272189673399518,
+    0.9273625256504011, 0.9275059475749752, 0.9276492330925812, 0.9277923821821463,
+    0.9279353948226179, 0.928078270992963, 0.9282210106721694, 0.9283636138392444,
+    0.9285060804732156, 0.9286484105531305, 0.928790604058057, 0.9289326609670828,
+    0.9290745812593157, 0.929216364913884, 0.9293580119099355, 0.9294995222266386,
+    0.9296408958431812, 0.9297821327387722, 0.9299232328926397, 0.9300641962840324,
+    0.9302050228922191, 0.9303457126964885, 0.9304862656761497, 0.9306266818105318,
+    0.9307669610789837, 0.9309071034608751, 0.9310471089355953, 0.9311869774825537,
+    0.9313267090811804, 0.9314663037109251, 0.9316057613512578, 0.9317450819816687,
+    0.9318842655816681, 0.9320233121307865, 0.9321622216085744, 0.9323009939946028,
+    0.9324396292684624, 0.9325781274097644, 0.9327164883981403, 0.9328547122132411,
+    0.9329927988347388, 0.9331307482423252, 0.933268560415712, 0.9334062353346315,
+    0.9335437729788362, 0.9336811733280984, 0.933818436362211, 0.9339555620609867,
+    0.9340925504042589, 0.9342294013718808, 0.9343661149437258, 0.9345026910996879,
+    0.9346391298196808, 0.9347754310836387, 0.9349115948715161, 0.9350476211632874,
+    0.9351835099389476, 0.9353192611785116, 0.9354548748620146, 0.9355903509695124,
+    0.9357256894810804, 0.9358608903768146, 0.9359959536368313, 0.936130879241267,
+    0.9362656671702783, 0.9364003174040421, 0.9365348299227555, 0.9366692047066362,
+    0.9368034417359216, 0.9369375409908699, 0.9370715024517592, 0.937205326098888,
+    0.937339011912575, 0.9374725598731591, 0.937605969961, 0.937739242156477,
+    0.9378723764399899, 0.9380053727919588, 0.9381382311928244, 0.9382709516230472,
+    0.9384035340631081, 0.9385359784935086, 0.9386682848947702, 0.9388004532474348,
+    0.9389324835320645, 0.939064375729242, 0.9391961298195699, 0.9393277457836714,
+    0.9394592236021899, 0.9395905632557892, 0.9397217647251533, 0.9398528279909867,
+    0.9399837530340139, 0.9401145398349803, 0.9402451883746509, 0.9403756986338115,
+    0.9405060705932683, 0.9406363042338476, 0.9407663995363961, 0.9408963564817808,
+    0.9410261750508893, 0.9411558552246292, 0.9412853969839287, 0.9414148003097362,
+    0.9415440651830208, 0.9416731915847714, 0.9418021794959976, 0.9419310288977295,
+    0.9420597397710173, 0.9421883120969318, 0.9423167458565638, 0.9424450410310249,
+    0.9425731976014469, 0.942701215548982, 0.9428290948548027, 0.9429568355001021,
+    0.9430844374660935, 0.9432119007340106, 0.9433392252851077, 0.9434664111006593,
+    0.9435934581619604, 0.9437203664503262, 0.9438471359470927, 0.943973766633616,
+    0.9441002584912727, 0.9442266115014598, 0.9443528256455948, 0.9444789009051155,
+    0.9446048372614803, 0.9447306346961678, 0.9448562931906772, 0.9449818127265281,
+    0.9451071932852606, 0.945232434848435, 0.9453575373976323, 0.9454825009144537,
+    0.9456073253805213, 0.9457320107774772, 0.9458565570869839, 0.9459809642907248,
+    0.9461052323704034, 0.9462293613077438, 0.9463533510844906, 0.9464772016824087,
+    0.9466009130832835, 0.9467244852689212, 0.946847918221148, 0.9469712119218109,
+    0.9470943663527772, 0.9472173814959348, 0.947340257333192, 0.9474629938464777,
+    0.9475855910177411, 0.9477080488289522, 0.947830367262101, 0.9479525462991987,
+    0.9480745859222762, 0.9481964861133856, 0.9483182468545991, 0.9484398681280096,
+    0.9485613499157303, 0.9486826921998951, 0.9488038949626585, 0.9489249581861952,
+    0.9490458818527006, 0.9491666659443907, 0.9492873104435021, 0.9494078153322916,
+    0.9495281805930367, 0.9496484062080355, 0.9497684921596067, 0.9498884384300893,
+    0.950008245001843, 0.9501279118572481, 0.9502474389787052, 0.9503668263486359,
+    0.9504860739494817, 0.9506051817637053, 0.9507241497737896, 0.9508429779622382,
+    0.9509616663115751, 0.951080214804345, 0.9511986234231132, 0.9513168921504656,
+    0.9514350209690083, 0.9515530098613686, 0.9516708588101939, 0.9517885677981521,
+    0.9519061368079323, 0.9520235658222436, 0.9521408548238158, 0.9522580037953996,
+    0.9523750127197659, 0.9524918815797063, 0.9526086103580333, 0.9527251990375796,
+    0.9528416476011987, 0.9529579560317647, 0.9530741243121722, 0.9531901524253367,
+    0.9533060403541939, 0.9534217880817003, 0.9535373955908333, 0.9536528628645905,
+    0.9537681898859903, 0.9538833766380718, 0.9539984231038945, 0.9541133292665388,
+    0.9542280951091057, 0.9543427206147165, 0.9544572057665135, 0.9545715505476596,
+    0.9546857549413383, 0.9547998189307537, 0.9549137424991305, 0.9550275256297142,
+    0.9551411683057707, 0.955254670510587, 0.9553680322274704, 0.9554812534397488,
+    0.9555943341307711, 0.9557072742839066, 0.9558200738825454, 0.9559327329100982,
+    0.9560452513499964, 0.9561576291856921, 0.956269866400658, 0.9563819629783877,
+    0.9564939189023951, 0.9566057341562151, 0.956717408723403, 0.9568289425875354,
+    0.9569403357322088, 0.957051588141041, 0.9571626997976701, 0.9572736706857552,
+    0.9573845007889759, 0.9574951900910326, 0.9576057385756463, 0.9577161462265589,
+    0.9578264130275329, 0.9579365389623514, 0.9580465240148186, 0.9581563681687588,
+    0.9582660714080177, 0.9583756337164612, 0.9584850550779761, 0.9585943354764702,
+    0.9587034748958716, 0.9588124733201293, 0.9589213307332132, 0.9590300471191137,
+    0.9591386224618419, 0.9592470567454301, 0.9593553499539308, 0.9594635020714175,
+    0.9595715130819845, 0.9596793829697468, 0.9597871117188399, 0.9598946993134205,
+    0.9600021457376658, 0.9601094509757739, 0.9602166150119634, 0.9603236378304739,
+    0.9604305194155658, 0.96053725975152, 0.9606438588226386, 0.960750316613244,
+    0.9608566331076797, 0.9609628082903098, 0.9610688421455194, 0.9611747346577141,
+    0.9612804858113206, 0.9613860955907862, 0.961491563980579, 0.9615968909651879,
+    0.9617020765291225, 0.9618071206569135, 0.9619120233331122, 0.9620167845422906,
+    0.9621214042690416, 0.962225882497979, 0.9623302192137374, 0.9624344144009721,
+    0.9625384680443592, 0.9626423801285957, 0.9627461506383994, 0.962849779558509,
+    0.9629532668736839, 0.9630566125687043, 0.9631598166283714, 0.9632628790375071,
+    0.963365799780954, 0.963468578843576, 0.9635712162102573, 0.9636737118659032,
+    0.9637760657954398, 0.9638782779838142, 0.9639803484159941, 0.9640822770769681,
+    0.9641840639517458, 0.9642857090253575, 0.9643872122828543, 0.9644885737093084,
+    0.9645897932898128, 0.964690871009481, 0.9647918068534479, 0.9648926008068689,
+    0.9649932528549203, 0.9650937629827996, 0.9651941311757247, 0.9652943574189347,
+    0.9653944416976894, 0.9654943839972695, 0.9655941843029768, 0.9656938426001337,
+    0.9657933588740837, 0.9658927331101909, 0.9659919652938406, 0.9660910554104388,
+    0.9661900034454125, 0.9662888093842097, 0.9663874732122989, 0.9664859949151698,
+    0.9665843744783331, 0.9666826118873202, 0.9667807071276833, 0.9668786601849959,
+    0.9669764710448521, 0.967074139692867, 0.9671716661146766, 0.9672690502959378,
+    0.9673662922223285, 0.9674633918795474, 0.9675603492533144, 0.9676571643293699,
+    0.9677538370934755, 0.9678503675314136, 0.9679467556289878, 0.9680430013720223,
+    0.9681391047463624, 0.9682350657378743, 0.9683308843324452, 0.9684265605159832,
+    0.9685220942744173, 0.9686174855936975, 0.9687127344597948, 0.968807840858701,
+    0.9689028047764289, 0.9689976261990124, 0.9690923051125062, 0.969186841502986,
+    0.9692812353565485, 0.9693754866593113, 0.9694695953974131, 0.9695635615570132,
+    0.9696573851242924, 0.9697510660854521, 0.9698446044267148, 0.969938000134324,
+    0.970031253194544, 0.9701243635936603, 0.9702173313179792, 0.9703101563538281,
+    0.9704028386875555, 0.9704953783055306, 0.9705877751941436, 0.9706800293398061,
+    0.9707721407289504, 0.9708641093480295, 0.970955935183518, 0.9710476182219111,
+    0.9711391584497251, 0.9712305558534974, 0.9713218104197862, 0.9714129221351709,
+    0.9715038909862518, 0.9715947169596502, 0.9716854000420085, 0.9717759402199901,
+    0.9718663374802794, 0.9719565918095817, 0.9720467031946235, 0.9721366716221522,
+    0.9722264970789363, 0.9723161795517653, 0.9724057190274498, 0.9724951154928212,
+    0.9725843689347322, 0.9726734793400564, 0.9727624466956886, 0.9728512709885442,
+    0.9729399522055602, 0.9730284903336942, 0.9731168853599251, 0.9732051372712528,
+    0.9732932460546982, 0.9733812116973033, 0.9734690341861311, 0.9735567135082656,
+    0.973644249650812, 0.9737316426008964, 0.9738188923456661, 0.9739059988722896,
+    0.9739929621679558, 0.9740797822198757, 0.9741664590152803, 0.9742529925414225,
+    0.9743393827855759, 0.974425629735035, 0.9745117333771157, 0.974597693699155,
+    0.9746835106885107, 0.9747691843325618, 0.9748547146187084, 0.9749401015343718,
+    0.9750253450669941, 0.9751104452040389, 0.9751954019329904, 0.9752802152413542,
+    0.975364885116657, 0.9754494115464464, 0.9755337945182914, 0.9756180340197818,
+    0.9757021300385286, 0.9757860825621639, 0.975869891578341, 0.9759535570747343,
+    0.976037079039039, 0.9761204574589719, 0.9762036923222706, 0.9762867836166936,
+    0.9763697313300211, 0.9764525354500541, 0.9765351959646145, 0.9766177128615456,
+    0.9767000861287118, 0.9767823157539987, 0.9768644017253126, 0.9769463440305817,
+    0.9770281426577544, 0.9771097975948009, 0.9771913088297123, 0.9772726763505009,
+    0.9773539001452, 0.9774349802018643, 0.9775159165085693, 0.9775967090534119,
+    0.9776773578245099, 0.9777578628100028, 0.9778382239980504, 0.9779184413768344,
+    0.9779985149345571, 0.9780784446594424, 0.978158230539735, 0.9782378725637011,
+    0.9783173707196277, 0.9783967249958231, 0.9784759353806168, 0.9785550018623596,
+    0.9786339244294232, 0.9787127030702004, 0.9787913377731057, 0.9788698285265741,
+    0.9789481753190622, 0.9790263781390476, 0.9791044369750292, 0.9791823518155269,
+    0.979260122649082, 0.9793377494642568, 0.9794152322496348, 0.9794925709938208,
+    0.9795697656854405, 0.9796468163131412, 0.9797237228655912, 0.9798004853314798,
+    0.9798771036995176, 0.9799535779584367, 0.9800299080969901, 0.9801060941039518,
+    0.9801821359681174, 0.9802580336783036, 0.980333787223348, 0.9804093965921099,
+    0.9804848617734694, 0.9805601827563278, 0.9806353595296081, 0.980710392082254,
+    0.9807852804032304, 0.9808600244815239, 0.9809346243061416, 0.9810090798661126,
+    0.9810833911504867, 0.9811575581483348, 0.9812315808487497, 0.9813054592408447,
+    0.9813791933137546, 0.9814527830566355, 0.9815262284586648, 0.9815995295090407,
+    0.9816726861969831, 0.981745698511733, 0.9818185664425525, 0.9818912899787251,
+    0.9819638691095552, 0.982036303824369, 0.9821085941125136, 0.9821807399633571,
+    0.9822527413662894, 0.9823245983107213, 0.9823963107860847, 0.9824678787818332,
+    0.9825393022874412, 0.9826105812924048, 0.9826817157862409, 0.9827527057584878,
+    0.9828235511987052, 0.9828942520964741, 0.9829648084413964, 0.9830352202230956,
+    0.9831054874312163, 0.9831756100554244, 0.9832455880854071, 0.9833154215108728,
+    0.9833851103215512, 0.9834546545071933, 0.9835240540575713, 0.9835933089624787,
+    0.9836624192117303, 0.9837313847951621, 0.9838002057026316, 0.9838688819240172,
+    0.9839374134492189, 0.9840058002681579, 0.9840740423707764, 0.9841421397470386,
+    0.984210092386929, 0.9842779002804544, 0.9843455634176419, 0.9844130817885407,
+    0.9844804553832209, 0.984547684191774, 0.9846147682043126, 0.9846817074109709,
+    0.9847485018019042, 0.9848151513672891, 0.9848816560973237, 0.984948015982227,
+    0.9850142310122398, 0.9850803011776238, 0.9851462264686622, 0.9852120068756594,
+    0.9852776423889412, 0.9853431329988548, 0.9854084786957684, 0.9854736794700718,
+    0.9855387353121761, 0.9856036462125134, 0.9856684121615376, 0.9857330331497235,
+    0.9857975091675675, 0.985861840205587, 0.9859260262543211, 0.9859900673043301,
+    0.9860539633461954, 0.9861177143705201, 0.9861813203679283, 0.9862447813290655,
+    0.9863080972445987, 0.986371268105216, 0.9864342939016272, 0.9864971746245629,
+    0.9865599102647754, 0.9866225008130385, 0.9866849462601467, 0.9867472465969165,
+    0.9868094018141855, 0.9868714119028125, 0.9869332768536777, 0.986994996657683,
+    0.987056571305751, 0.9871180007888263, 0.9871792850978743, 0.9872404242238823,
+    0.9873014181578584, 0.9873622668908324, 0.9874229704138554, 0.9874835287179997,
+    0.9875439417943592, 0.9876042096340492, 0.9876643322282057, 0.987724309567987,
+    0.9877841416445722, 0.9878438284491617, 0.9879033699729778, 0.9879627662072634,
+    0.9880220171432835, 0.9880811227723241, 0.9881400830856926, 0.9881988980747176,
+    0.9882575677307495, 0.9883160920451597, 0.9883744710093413, 0.9884327046147083,
+    0.9884907928526966, 0.9885487357147632, 0.9886065331923864, 0.9886641852770662,
+    0.9887216919603238, 0.9887790532337015, 0.9888362690887635, 0.9888933395170951,
+    0.988950264510303, 0.9890070440600153, 0.9890636781578815, 0.9891201667955727,
+    0.989176509964781, 0.98923270765722, 0.9892887598646252, 0.9893446665787526,
+    0.9894004277913804, 0.9894560434943077, 0.9895115136793552, 0.9895668383383651,
+    0.9896220174632009, 0.9896770510457472, 0.9897319390779106, 0.9897866815516186,
+    0.9898412784588205, 0.9898957297914867, 0.989950035541609, 0.9900041957012009,
+    0.9900582102622971, 0.9901120792169538, 0.9901658025572484, 0.99021938027528,
+    0.9902728123631691, 0.9903260988130573, 0.9903792396171082, 0.990432234767506,
+    0.9904850842564571, 0.9905377880761888, 0.9905903462189501, 0.9906427586770116,
+    0.9906950254426646, 0.9907471465082227, 0.9907991218660204, 0.9908509515084136,
+    0.99090263542778, 0.9909541736165185, 0.9910055660670494, 0.9910568127718143,
+    0.9911079137232769, 0.9911588689139214, 0.9912096783362541, 0.9912603419828024,
+    0.9913108598461154, 0.9913612319187635, 0.9914114581933385, 0.9914615386624538,
+    0.9915114733187439, 0.9915612621548653, 0.9916109051634954, 0.9916604023373332,
+    0.9917097536690995, 0.9917589591515361, 0.9918080187774064, 0.9918569325394955,
+    0.9919057004306093, 0.991954322443576, 0.9920027985712445, 0.9920511288064857,
+    0.9920993131421918, 0.9921473515712761, 0.9921952440866739, 0.9922429906813417,
+    0.9922905913482574, 0.9923380460804204, 0.9923853548708517, 0.9924325177125937,
+    0.99247953459871, 0.9925264055222861, 0.9925731304764288, 0.9926197094542661,
+    0.992666142448948, 0.9927124294536455, 0.9927585704615511, 0.9928045654658791,
+    0.9928504144598651, 0.992896117436766, 0.9929416743898605, 0.9929870853124484,
+    0.9930323501978514, 0.9930774690394123, 0.9931224418304956, 0.9931672685644872,
+    0.9932119492347945, 0.9932564838348464, 0.9933008723580933, 0.9933451147980069,
+    0.9933892111480807, 0.9934331614018294, 0.9934769655527892, 0.9935206235945181,
+    0.9935641355205953, 0.9936075013246216, 0.9936507210002191, 0.9936937945410318,
+    0.9937367219407246, 0.9937795031929846, 0.9938221382915197, 0.9938646272300597,
+    0.9939069700023561, 0.9939491666021811, 0.9939912170233294, 0.9940331212596164,
+    0.9940748793048794, 0.9941164911529771, 0.9941579567977897, 0.9941992762332189,
+    0.9942404494531879, 0.9942814764516416, 0.9943223572225458, 0.9943630917598886,
+    0.9944036800576791, 0.994444122109948, 0.9944844179107476, 0.9945245674541517,
+    0.9945645707342554, 0.9946044277451757, 0.9946441384810507, 0.9946837029360402,
+    0.9947231211043257, 0.9947623929801099, 0.9948015185576171, 0.9948404978310932,
+    0.9948793307948056, 0.9949180174430432, 0.9949565577701164, 0.994994951770357,
+    0.9950331994381186, 0.9950713007677762, 0.9951092557537261, 0.9951470643903865,
+    0.9951847266721969, 0.9952222425936184, 0.9952596121491334, 0.9952968353332461,
+    0.9953339121404823, 0.995370842565389, 0.9954076266025349, 0.9954442642465103,
+    0.9954807554919269, 0.9955171003334181, 0.9955532987656385, 0.9955893507832646,
+    0.9956252563809943, 0.9956610155535469, 0.9956966282956635, 0.9957320946021064,
+    0.9957674144676598, 0.9958025878871292, 0.9958376148553416, 0.9958724953671457,
+    0.9959072294174117, 0.9959418170010313, 0.9959762581129178, 0.9960105527480059,
+    0.996044700901252, 0.996078702567634, 0.9961125577421511, 0.9961462664198246,
+    0.996179828595697, 0.996213244264832, 0.9962465134223155, 0.9962796360632546,
+    0.996312612182778, 0.9963454417760359, 0.9963781248382002, 0.9964106613644641,
+    0.9964430513500426, 0.9964752947901722, 0.9965073916801108, 0.9965393420151379,
+    0.9965711457905548, 0.9966028030016841, 0.9966343136438699, 0.9966656777124782,
+    0.9966968952028961, 0.9967279661105325, 0.996758890430818, 0.9967896681592046,
+    0.9968202992911657, 0.9968507838221966, 0.9968811217478138, 0.9969113130635557,
+    0.9969413577649822, 0.9969712558476743, 0.9970010073072353, 0.9970306121392895,
+    0.997060070339483, 0.9970893819034834, 0.99711854682698, 0.9971475651056835,
+    0.9971764367353262, 0.9972051617116618, 0.9972337400304663, 0.9972621716875362,
+    0.9972904566786902, 0.9973185949997686, 0.9973465866466332, 0.9973744316151671,
+    0.9974021299012753, 0.9974296815008842, 0.9974570864099419, 0.9974843446244179,
+    0.9975114561403035, 0.9975384209536113, 0.9975652390603758, 0.9975919104566526,
+    0.9976184351385196, 0.9976448131020754, 0.997671044343441, 0.9976971288587585,
+    0.9977230666441916, 0.9977488576959257, 0.9977745020101678, 0.9977999995831465,
+    0.9978253504111116, 0.9978505544903351, 0.9978756118171102, 0.9979005223877516,
+    0.997925286198596, 0.9979499032460012, 0.997974373526347, 0.9979986970360344,
+    0.9980228737714862, 0.9980469037291468, 0.9980707869054823, 0.99809452329698,
+    0.9981181129001492, 0.9981415557115205, 0.9981648517276462, 0.9981880009451003,
+    0.9982110033604782, 0.9982338589703968, 0.9982565677714952, 0.9982791297604332,
+    0.9983015449338929, 0.9983238132885776, 0.9983459348212124, 0.9983679095285438,
+    0.9983897374073402, 0.9984114184543913, 0.9984329526665084, 0.9984543400405248,
+    0.9984755805732948, 0.9984966742616946, 0.9985176211026222, 0.9985384210929967,
+    0.9985590742297593, 0.9985795805098725, 0.9985999399303204, 0.9986201524881089,
+    0.9986402181802653, 0.9986601370038385, 0.9986799089558991, 0.9986995340335393,
+    0.9987190122338729, 0.9987383435540352, 0.9987575279911833, 0.9987765655424956,
+    0.9987954562051724, 0.9988141999764354, 0.998832796853528, 0.9988512468337152,
+    0.9988695499142836, 0.9988877060925413, 0.9989057153658183, 0.9989235777314658,
+    0.9989412931868569, 0.9989588617293861, 0.9989762833564698, 0.9989935580655457,
+    0.9990106858540734, 0.9990276667195337, 0.9990445006594293, 0.9990611876712846,
+    0.9990777277526454, 0.9990941209010791, 0.9991103671141749, 0.9991264663895434,
+    0.9991424187248169, 0.9991582241176494, 0.9991738825657164, 0.9991893940667149,
+    0.9992047586183639, 0.9992199762184035, 0.9992350468645959, 0.9992499705547244,
+    0.9992647472865944, 0.9992793770580327, 0.9992938598668878, 0.9993081957110295,
+    0.9993223845883495, 0.9993364264967612, 0.9993503214341994, 0.9993640693986205,
+    0.9993776703880028, 0.999391124400346, 0.9994044314336713, 0.9994175914860217,
+    0.9994306045554617, 0.9994434706400778, 0.9994561897379773, 0.99946876184729,
+    0.999481186966167, 0.9994934650927806, 0.9995055962253253, 0.999517580362017,
+    0.9995294175010931, 0.9995411076408129, 0.999552650779457, 0.9995640469153277,
+    0.9995752960467492, 0.9995863981720671, 0.9995973532896484, 0.9996081613978821,
+    0.9996188224951786, 0.9996293365799701, 0.9996397036507102, 0.9996499237058742,
+    0.9996599967439592, 0.9996699227634838, 0.9996797017629879, 0.9996893337410336,
+    0.9996988186962042, 0.9997081566271049, 0.9997173475323622, 0.9997263914106245,
+    0.9997352882605617, 0.9997440380808654, 0.9997526408702488, 0.9997610966274466,
+    0.9997694053512153, 0.9997775670403329, 0.9997855816935992, 0.9997934493098353,
+    0.9998011698878843, 0.9998087434266105, 0.9998161699249004, 0.9998234493816616,
+    0.9998305817958234, 0.9998375671663371, 0.9998444054921752, 0.9998510967723322,
+    0.9998576410058239, 0.9998640381916877, 0.999870288328983, 0.9998763914167904,
+    0.9998823474542126, 0.9998881564403733, 0.9998938183744185, 0.9998993332555154,
+    0.9999047010828529, 0.9999099218556415, 0.9999149955731135, 0.9999199222345228,
+    0.9999247018391445, 0.9999293343862761, 0.999933819875236, 0.9999381583053646,
+    0.9999423496760239, 0.9999463939865975, 0.9999502912364905, 0.9999540414251298,
+    0.9999576445519639, 0.9999611006164628, 0.9999644096181183, 0.9999675715564438,
+    0.9999705864309741, 0.9999734542412659, 0.9999761749868976, 0.9999787486674688,
+    0.9999811752826011, 0.9999834548319377, 0.9999855873151432, 0.9999875727319041,
+    0.9999894110819284, 0.9999911023649456, 0.9999926465807072, 0.9999940437289858,
+    0.9999952938095762, 0.9999963968222944, 0.9999973527669782, 0.999998161643487,
+    0.9999988234517019, 0.9999993381915255, 0.9999997058628822, 0.9999999264657179,
+    1.0
+};
+
+} // impl
+} // genfft
+
+#endif /* GEN_FFT_SINE_TABLE_H */
@@ -30,103 +30,224 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdlib.h>
 #include <cmath>
 #include <utility>
+#include <atomic>
+#include <mutex>
+#include <cassert>
+#include <vector>
+#include <memory>
 #include "FFTAlloc.h"
+#include "FFTSineTable.h"
 
 namespace genfft {
 
-/// @brief Twiddling factors for FFT
-template <int _N, class T>
-struct Twiddle
+/// @brief W^j = exp(-2*pi*i*j/N) for 0 <= j < N, computed from a quarter-wave sine table
+///
+/// Up to impl::SineTable<>::size the table is a subsample of the baked one. Above that,
+/// the quarter-wave is refined from the baked samples: each step fills in the samples
+/// halfway between the known ones by angle addition, with the sine and cosine of the
+/// (small) half step from their Taylor series, so no libm calls are made either.
+/// The rest of the circle follows from the symmetries of sin and cos, which are exact.
+/// Sizes that are not powers of two are evaluated directly.
+template <class T>
+class UnitCircle
 {
-    static constexpr int N = _N;
-    constexpr inline T operator[](int i) const noexcept { return t[i]; }
-    alignas(32) T t[N];
-    Twiddle()
+    typedef impl::SineTable<> Baked;
+public:
+    explicit UnitCircle(int N) : N(N)
     {
-        for (int i=0; i<N; i+=2)
+        if (N & (N-1))
+        {
+            sine = nullptr;
+            log2quarter = step = 0;
+        }
+        else if (N <= Baked::size)
         {
-            t[i]   =  std::cos(M_PI*i/N);
-            t[i+1] = -std::sin(M_PI*i/N);
+            sine = Baked::values;
+            log2quarter = Baked::log2size - 2;
+            step = Baked::size / N;
+        }
+        else
+        {
+            int quarter = N/4;
+            computed.resize(quarter+1);
+            int stride = N / Baked::size;
+            for (int j=0; j<=quarter; j+=stride)
+                computed[j] = Baked::values[j/stride];
+            for (; stride > 1; stride /= 2)
+            {
+                // the half step d is below 2*pi/Baked::size, so a few terms of the Taylor series
+                // give its sine and cosine to full precision
+                int half = stride/2;
+                double d = 2*M_PI*half/N, d2 = d*d;
+                double s = d * (1 - d2/6 * (1 - d2/20 * (1 - d2/42)));
+                double c = 1 - d2/2 * (1 - d2/12 * (1 - d2/30));
+                // sin(a + d) = sin(a)cos(d) + cos(a)sin(d); cos(a) is the sample at quarter - a
+                for (int j=half; j<quarter; j+=stride)
+                    computed[j] = computed[j-half]*c + computed[quarter-j+half]*s;
+            }
+            sine = computed.data();
+            log2quarter = 0;
+            while ((1 << log2quarter) < quarter)
+                log2quarter++;
+            step = 1;
         }
     }
+
+    /// @brief Stores the real and imaginary part of W^j at w[0] and w[1]
+    void get(T *w, int j) const
+    {
+        if (!sine)
+        {
+            w[0] =  std::cos(2*M_PI*j/N);
+            w[1] = -std::sin(2*M_PI*j/N);
+            return;
+        }
+        int i = j * step;
+        int quarter = 1 << log2quarter;
+        int q = i >> log2quarter, r = i & (quarter-1);
+        double s = sine[r], c = sine[quarter-r];
+        switch (q & 3)
+        {
+        case 0: w[0] = c;  w[1] = -s; break;
+        case 1: w[0] = -s; w[1] = -c; break;
+        case 2: w[0] = -c; w[1] = s;  break;
+        default: w[0] = s; w[1] = c;  break;
+        }
+    }
+
+private:
+    int N;
+    const double *sine;
+    int log2quarter, step;
+    std::vector<double> computed;
 };
 
-/// @brief Twiddling factors for FFT
+/// @brief Process-wide twiddle tables, shared by all levels and plans of type T.
+///
+/// There is one table of each kind per size, built on first use; W = exp(-2*pi*i/N)
+/// and the numbers are interleaved. The radix-2 table for N points contains W^k for k < N/2.
+/// A radix-4 level needs W^k, W^2k and W^3k for k < N/4: the first two are the radix-2 tables
+/// for N and N/2 points (the prefix of one, all of the other), so only W^3k has a table
+/// of its own. Plans of sizes N and 2N, and the radix-2 and radix-4 levels, thus share
+/// all the radix-2 tables they have in common.
+///
+/// The levels hold references to the tables, so a table is freed with the last plan that
+/// uses it; the memory of the tables is thus bounded by the plans that PlanRetention keeps.
 template <class T>
-struct Twiddle<-1, T>
+class TwiddleTable
 {
-    constexpr inline T operator[](int i) const noexcept { return t[i]; }
-    T *t = nullptr;
-    int N = 0;
+public:
+    static std::shared_ptr<const T> radix2(int N) { return instance().get(0, N); }
+    /// @brief W^3k for k < N/4 - the part of a radix-4 level's factors not in the radix-2 tables
+    static std::shared_ptr<const T> radix4_w3(int N) { return instance().get(1, N); }
+
+private:
+    TwiddleTable() = default;
 
-    Twiddle() = default;
-    explicit Twiddle(int n) : N(n)
+    static TwiddleTable &instance()
     {
-        t = aligned_alloc_T<T>(N, 32);
-        for (int i=0; i<N; i+=2)
-        {
-            t[i]   =  std::cos(M_PI*i/N);
-            t[i+1] = -std::sin(M_PI*i/N);
-        }
+        // never destroyed - plans may outlive static destruction
+        static TwiddleTable *table = new TwiddleTable();
+        return *table;
     }
 
-    Twiddle(const Twiddle &) = delete;
-    Twiddle(Twiddle &&other) : t(other.t), N(other.N)
+    std::shared_ptr<const T> get(int kind, int N)
     {
-        other.t = nullptr;
-        other.N = 0;
+        int log2N = 0;
+        while ((1 << log2N) < N)
+            log2N++;
+        assert((1 << log2N) == N && log2N < 32);
+        // Tables are only looked up when levels are constructed, so a lock is fine here
+        std::lock_guard<std::mutex> guard(lock);
+        std::shared_ptr<const T> t = levels[kind][log2N].lock();
+        if (!t)
+        {
+            t = std::shared_ptr<const T>(kind ? build_radix4_w3(N) : build_radix2(N),
+                                         [](const T *p) { free((void*)p); });
+            levels[kind][log2N] = t;
+        }
+        return t;
     }
 
-    Twiddle &operator=(const Twiddle &) = delete;
-    Twiddle &operator=(Twiddle &other)
+    static T *build_radix2(int N)
     {
-        std::swap(t, other.t);
-        std::swap(N, other.N);
-        return *this;
+        T *t = aligned_alloc_T<T>(N < 8 ? 8 : N, 32);
+        UnitCircle<T> circle(N);
+        for (int k=0; k<N/2; k++)
+            circle.get(t + 2*k, k);
+        return t;
     }
 
-    ~Twiddle()
+    static T *build_radix4_w3(int N)
     {
-        free(t);
-        t = nullptr;
+        T *t = aligned_alloc_T<T>(N/2 < 8 ? 8 : N/2, 32);
+        UnitCircle<T> circle(N);
+        for (int k=0; k<N/4; k++)
+            circle.get(t + 2*k, 3*k);
+        return t;
     }
-};
 
+    std::weak_ptr<const T> levels[2][32];
+    std::mutex lock;
+};
 
-/// @brief Twiddling factors for Decimation in Time (real input FFT)
-template <int _N, typename T>
-struct DITTwiddle
+/// @brief Twiddling factors for a radix-2 FFT level, taken from the shared TwiddleTable
+template <int _N, class T>
+struct SharedTwiddle
 {
     static constexpr int N = _N;
-    constexpr T operator[](int i) const noexcept { return t[i]; }
-    static constexpr int pad = 32/sizeof(T) < 2 ? 2 : 32/sizeof(T);
-    alignas(32) T t[N/2+pad];
-
-    DITTwiddle()
-    {
-        Init(N);
-    }
+    SharedTwiddle() : table(TwiddleTable<T>::radix2(N)), t(table.get()) {}
+    inline T operator[](int i) const noexcept { return t[i]; }
+    std::shared_ptr<const T> table;
+    const T *t;
+};
 
+/// @brief Twiddling factors for a runtime-sized radix-2 FFT level
+template <class T>
+struct SharedTwiddle<-1, T>
+{
+    explicit SharedTwiddle(int n) : N(n), table(TwiddleTable<T>::radix2(n)), t(table.get()) {}
+    inline T operator[](int i) const noexcept { return t[i]; }
+    int N;
+    std::shared_ptr<const T> table;
+    const T *t;
+};
 
-    explicit DITTwiddle(int n)
-    {
-        Init(n);
-    }
+/// @brief Twiddling factors for a radix-4 FFT level, taken from the shared TwiddleTable
+///
+/// w1(), w2() and w3() point to W^k, W^2k and W^3k for k < N/4.
+template <int _N, class T>
+struct SharedTwiddle4
+{
+    static constexpr int N = _N;
+    SharedTwiddle4()
+    : table1(TwiddleTable<T>::radix2(N)), table2(TwiddleTable<T>::radix2(N/2))
+    , table3(TwiddleTable<T>::radix4_w3(N)) {}
+    const T *w1() const noexcept { return table1.get(); }
+    const T *w2() const noexcept { return table2.get(); }
+    const T *w3() const noexcept { return table3.get(); }
+    std::shared_ptr<const T> table1, table2, table3;
+};
 
-    void Init(int n)
-    {
-        assert(n == N);
-        int i;
-        for (i=0; i<=N/2; i+=2)
-        {
-            t[i] = std::sin(M_PI*i/N);
-            t[i+1] = std::cos(M_PI*i/N);
-        }
-        for (; i<N/2+pad; i++)
-            t[i] = 0;
-    }
+/// @brief Twiddling factors for a runtime-sized radix-4 FFT level
+template <class T>
+struct SharedTwiddle4<-1, T>
+{
+    explicit SharedTwiddle4(int n)
+    : N(n), table1(TwiddleTable<T>::radix2(n)), table2(TwiddleTable<T>::radix2(n/2))
+    , table3(TwiddleTable<T>::radix4_w3(n)) {}
+    const T *w1() const noexcept { return table1.get(); }
+    const T *w2() const noexcept { return table2.get(); }
+    const T *w3() const noexcept { return table3.get(); }
+    int N;
+    std::shared_ptr<const T> table1, table2, table3;
 };
 
+
+/// @brief Twiddling factors for Decimation in Time (real input FFT)
+template <int _N, typename T>
+struct DITTwiddle;
+
 /// @brief Twiddling factors for Decimation in Time (real input FFT)
 template <typename T>
 struct DITTwiddle<-1, T>
@@ -151,18 +272,21 @@ struct DITTwiddle<-1, T>
         if (N == 0)
             return;
         t = aligned_alloc_T<T>(N/2+pad, 32);
+        UnitCircle<T> circle(N);
         int i;
         for (i=0; i<=N/2; i+=2)
         {
-            t[i] = std::sin(M_PI*i/N);
-            t[i+1] = std::cos(M_PI*i/N);
+            T w[2];
+            circle.get(w, i/2);
+            t[i] = -w[1];
+            t[i+1] = w[0];
         }
         for (; i<N/2+pad; i++)
             t[i] = 0;
     }
 
     DITTwiddle(const DITTwiddle &) = delete;
-    DITTwiddle(DITTwiddle &&other) : t(other.t), N(other.N)
+    DITTwiddle(DITTwiddle &&other) : N(other.N), t(other.t)
     {
         other.t = nullptr;
         other.N = 0;
@@ -35,6 +35,38 @@ namespace genfft {
 using stride_t = ptrdiff_t;
 using index_t = int;
 
+/// @brief Algorithm used by a 1D FFT plan
+enum class FFTAlgorithm
+{
+    /// In-place decimation in time, preceded by reordering of the input;
+    /// with the dispatch backend, transforms of naturally ordered data use the
+    /// algorithm recorded in the wisdom instead, if there's one for the size
+    Default,
+    /// Out-of-place Stockham autosort - no reordering; power-of-two sizes only,
+    /// other sizes use the default algorithm
+    Stockham,
+};
+
+/// @brief How long the plan registry keeps plans that are no longer referenced
+enum class PlanRetention
+{
+    /// Plans are destroyed with the last FFT object using them
+    Weak,
+    /// Plans are kept until the policy is changed
+    Pin,
+    /// Least recently used plans are released when their total size exceeds a budget
+    LRU,
+};
+
+/// @brief Kind of convolution computed by Convolver
+enum class ConvolutionMode
+{
+    /// Full linear convolution - signal_len + kernel_len - 1 output values
+    Linear,
+    /// Circular convolution with period signal_len
+    Circular,
+};
+
 } // genfft
 
 #endif // GENFFT_FFT_TYPES_H
@@ -29,6 +29,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define GEN_FFT_UTIL_H
 
 #include <type_traits>
+#include <utility>
 #include "FFTTypes.h"
 
 namespace genfft
@@ -48,9 +49,98 @@ inline typename std::enable_if<(N>1), void>::type static_scramble(T *out, const
     static_scramble<N/2, T, U>(out + stride, in + N/2, 2 * stride);
 }
 
+#ifndef GENFFT_SCRAMBLE_BLOCK_LOG2
+/// @brief log2 of the tile size used by the cache-blocked bit reversal
+#define GENFFT_SCRAMBLE_BLOCK_LOG2 5
+#endif
+
+/// @brief Reverses the order of the lowest `bits` bits of x
+inline unsigned reverse_bits(unsigned x, int bits)
+{
+    unsigned r = 0;
+    for (int i = 0; i < bits; i++, x >>= 1)
+        r = (r << 1) | (x & 1);
+    return r;
+}
+
+/// @brief Index geometry of the cache-blocked bit reversal (COBRA)
+///
+/// An index is split into a high part a, a middle part c and a low part d, the outer parts
+/// being GENFFT_SCRAMBLE_BLOCK_LOG2 bits wide; its reversal is rev(d), rev(c), rev(a).
+/// For each c, the rows (a, c, *) of the input are read into a small tile, which is then
+/// written out as the rows (*, rev(c), rev(a)). Both the reads and the writes are contiguous
+/// runs, so each cache line (and, for large N, each page) is visited once per tile rather
+/// than once per element.
+struct ScrambleBlocks
+{
+    enum { block_log2 = GENFFT_SCRAMBLE_BLOCK_LOG2, block = 1 << block_log2 };
+
+    explicit ScrambleBlocks(int log2n)
+    : mid_log2(log2n - 2*block_log2), hi_shift(log2n - block_log2)
+    {
+        for (int i = 0; i < block; i++)
+            rev[i] = reverse_bits(i, block_log2);
+    }
+
+    unsigned tiles() const { return 1u << mid_log2; }
+    unsigned reverse_mid(unsigned c) const { return reverse_bits(c, mid_log2); }
+
+    /// @brief Reads the tile c of in, transposed, so that it can be stored at reverse_mid(c)
+    template <class T, class U>
+    void load(T *tile, const U *in, unsigned c, stride_t in_stride) const
+    {
+        const stride_t mid = (stride_t)c << block_log2;
+        for (int a = 0; a < block; a++)
+        {
+            const U *src = in + (((stride_t)a << hi_shift) + mid) * in_stride;
+            for (int d = 0; d < block; d++)
+                tile[d * block + rev[a]] = src[d * in_stride];
+        }
+    }
+
+    /// @brief Writes a tile loaded from reverse_mid(rc) at the rows (*, rc, *) of out
+    template <class T>
+    void store(T *out, const T *tile, unsigned rc, stride_t out_stride) const
+    {
+        const stride_t mid = (stride_t)rc << block_log2;
+        for (int d = 0; d < block; d++)
+        {
+            T *dst = out + (((stride_t)rev[d] << hi_shift) + mid) * out_stride;
+            for (int a = 0; a < block; a++)
+                dst[a * out_stride] = tile[d * block + a];
+        }
+    }
+
+    int mid_log2, hi_shift;
+    unsigned rev[block];
+};
+
+/// @brief Cache-blocked bit-reversal permutation of 2^log2n elements; see ScrambleBlocks
+template <class T, class U>
+void scramble_blocked(T *out, const U *in, int log2n, stride_t out_stride = 1, stride_t in_stride = 1)
+{
+    ScrambleBlocks blocks(log2n);
+    T tile[ScrambleBlocks::block * ScrambleBlocks::block];
+    for (unsigned c = 0; c < blocks.tiles(); c++)
+    {
+        blocks.load(tile, in, c, in_stride);
+        blocks.store(out, tile, blocks.reverse_mid(c), out_stride);
+    }
+}
+
+/// @brief Bit-reversal permutation of N (a power of 2) elements
 template <class T, class U>
 void scramble(T *out, const U *in, int N, stride_t stride = 1)
 {
+    // Small transforms fit in the cache anyway; above that, use the blocked permutation.
+    if (N >= (1 << (2*GENFFT_SCRAMBLE_BLOCK_LOG2 + 3)))
+    {
+        int log2n = 0;
+        while ((1 << log2n) < N)
+            log2n++;
+        scramble_blocked(out, in, log2n, stride);
+        return;
+    }
     switch (N)
     {
     case 0:
@@ -82,18 +172,109 @@ void scramble(T *out, const U *in, int N, stride_t stride = 1)
     }
 }
 
+///@brief Reorders the input as specified by the order array.
+///       A null order means bit-reversal for power-of-two N and natural order otherwise.
+template <class T, class U>
+void scramble(T *out, const U *in, int N, const int *order, stride_t stride = 1)
+{
+    if (!order)
+    {
+        if (N & (N-1))
+        {
+            for (int i = 0; i < N; i++)
+                out[i*stride] = in[i];
+        }
+        else
+        {
+            scramble<T, U>(out, in, N, stride);
+        }
+        return;
+    }
+    for (int i = 0; i < N; i++)
+        out[i*stride] = in[order[i]];
+}
+
+/// @brief Copies the rows of in to out in bit-reversed order; rows must be a power of 2
 template <class T, class U>
 void scramble_rows(T *out, stride_t out_stride, const U *in, stride_t in_stride, index_t rows, index_t cols)
 {
-    if (rows == 1)
+    enum { block_log2 = ScrambleBlocks::block_log2, block = ScrambleBlocks::block };
+    int log2rows = 0;
+    while ((1 << log2rows) < rows)
+        log2rows++;
+
+    auto copy_row = [&](index_t from, index_t to)
     {
-        for (index_t i=0; i<cols; i++)
-            out[i] = in[i];
+        const U *src = in + from * in_stride;
+        T *dst = out + to * out_stride;
+        for (index_t j = 0; j < cols; j++)
+            dst[j] = src[j];
+    };
+
+    if (cols == 1 && log2rows >= 2*block_log2)
+    {
+        scramble_blocked(out, in, log2rows, out_stride, in_stride);
+        return;
     }
-    else
+    if (log2rows < 2*block_log2)
+    {
+        for (index_t i = 0; i < rows; i++)
+            copy_row(i, reverse_bits(i, log2rows));
+        return;
+    }
+
+    // Same traversal as scramble_blocked, without the tile - the rows are copied directly.
+    ScrambleBlocks blocks(log2rows);
+    for (unsigned c = 0; c < blocks.tiles(); c++)
+    {
+        const index_t out_mid = blocks.reverse_mid(c) << block_log2;
+        for (int a = 0; a < block; a++)
+            for (int d = 0; d < block; d++)
+                copy_row((a << blocks.hi_shift) + (c << block_log2) + d, (blocks.rev[d] << blocks.hi_shift) + out_mid + blocks.rev[a]);
+    }
+}
+
+/// @brief Bit-reversal permutation of N (a power of 2) elements, in place
+///
+/// Tiles c and rev(c) trade places, so they are loaded together and stored swapped;
+/// small arrays are permuted with plain swaps.
+template <class T>
+void scramble_inplace(T *data, int N)
+{
+    int log2n = 0;
+    while ((1 << log2n) < N)
+        log2n++;
+
+    if (N < (1 << (2*GENFFT_SCRAMBLE_BLOCK_LOG2 + 3)))
+    {
+        // j is the bit-reversed i, maintained with a reversed increment
+        for (int i = 0, j = 0; i < N; i++)
+        {
+            if (i < j)
+                std::swap(data[i], data[j]);
+            int bit = N >> 1;
+            for (; j & bit; bit >>= 1)
+                j ^= bit;
+            j |= bit;
+        }
+        return;
+    }
+
+    ScrambleBlocks blocks(log2n);
+    T tile[ScrambleBlocks::block * ScrambleBlocks::block];
+    T rtile[ScrambleBlocks::block * ScrambleBlocks::block];
+    for (unsigned c = 0; c < blocks.tiles(); c++)
     {
-        scramble_rows<T, U>(out,            2*out_stride, in,                    in_stride, rows/2, cols);
-        scramble_rows<T, U>(out+out_stride, 2*out_stride, in+(rows/2)*in_stride, in_stride, rows/2, cols);
+        unsigned rc = blocks.reverse_mid(c);
+        if (rc < c)
+            continue;  // already swapped with rc
+        blocks.load(tile, data, c, 1);
+        if (rc != c)
+        {
+            blocks.load(rtile, data, rc, 1);
+            blocks.store(data, rtile, c, 1);
+        }
+        blocks.store(data, tile, rc, 1);
     }
 }
 
@@ -31,9 +31,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "FFTDecl.h"
 #include "FFTLevel.h"
 #include "FFTDIT.h"
+#include "FFTPointwise.h"
 #include "FFTBackend.h"
 #include <complex>
 #include <cassert>
+#include <vector>
 
 ///@brief GenFFT - generic FFT
 namespace genfft {
@@ -45,25 +47,48 @@ using FFTVertImplPtr = std::shared_ptr<impl::FFTVertBase<T>>;
 template <typename T>
 using FFTDITImplPtr = std::shared_ptr<impl::FFTDITBase<T>>;
 template <typename T>
+using FFTDIFImplPtr = std::shared_ptr<impl::FFTDIFBase<T>>;
+template <typename T>
+using FFTPointwiseImplPtr = std::shared_ptr<impl::FFTPointwiseBase<T>>;
+template <typename T>
 using FFTImplFactory = FFTImplPtr<T>(int n, T);
 template <typename T>
 using FFTVertImplFactory = FFTVertImplPtr<T>(int n, T);
 template <typename T>
 using FFTDITImplFactory = FFTDITImplPtr<T>(int n, T);
+template <typename T>
+using FFTDIFImplFactory = FFTDIFImplPtr<T>(int n, T);
 
 ///@brief A 1D FFT for densely packed data
 ///@tparam T scalar type
-template <class T, FFTImplFactory<T> *factory = backend::GetImpl>
+template <class T, FFTImplFactory<T> *factory = backend::GetImpl,
+          FFTImplFactory<T> *stockham_factory = backend::GetStockhamImpl,
+          FFTImplFactory<T> *tuned_factory = backend::GetTunedImpl>
 struct FFT
 {
     FFT()=default;
-    explicit FFT(int n)
+    explicit FFT(int n) : FFT(n, FFTAlgorithm::Default) {}
+
+    FFT(int n, FFTAlgorithm algorithm)
     {
-        impl = factory(n, T());
+        if (algorithm == FFTAlgorithm::Stockham)
+        {
+            impl = stockham_factory(n, T());
+            natural = impl;
+        }
+        else
+        {
+            // transform_no_scramble needs the reordered input of the default plan;
+            // the transforms of naturally ordered data can use whichever is fastest
+            impl = factory(n, T());
+            natural = tuned_factory(n, T());
+        }
         this->n = n;
     }
 
-    ///@brief Computes transform in-place, without data reordering
+    ///@brief Computes transform in-place, without data reordering.
+    ///       The input must be in the order given by the implementation's input_order -
+    ///       if that is null, bit-reversed for power-of-two sizes and natural otherwise.
     ///@tparam inv if true, computes inverse transform
     ///@param inout data array
     template <bool inv>
@@ -75,13 +100,24 @@ struct FFT
 
     ///@brief Computes transform
     ///@tparam inv if true, computes inverse transform
-    ///@param out output array
+    ///@param out output array, must not be equal to in - see transform_inplace
     ///@param out input array
     template <bool inv>
     void transform(std::complex<T> *out, const std::complex<T> *in)
     {
-        scramble((complex<T>*)out, (const complex<T>*)in, n);
-        impl->template transform<inv>((T*)out);
+        natural->template transform<inv>((T*)out, (const T*)in);
+    }
+
+    ///@brief Computes transform in place, with naturally ordered input and output
+    ///
+    ///       Power-of-two transforms reorder the data with an in-place bit reversal,
+    ///       so no second buffer is needed; other sizes use a temporary copy.
+    ///@tparam inv if true, computes inverse transform
+    ///@param inout data array
+    template <bool inv>
+    void transform_inplace(std::complex<T> *inout)
+    {
+        natural->template transform_inplace<inv>((T*)inout);
     }
 
     ///@brief Computes forward transform of real data
@@ -89,7 +125,7 @@ struct FFT
     ///@param out input array
     void transform_real(std::complex<T> *out, const T *in)
     {
-        scramble(out, in, n);
+        scramble(out, in, n, impl->input_order());
         impl->template transform<false>((T*)out);
     }
 
@@ -99,19 +135,49 @@ struct FFT
     ///@param out input array
     void transform_interleave(std::complex<T> *out, const T *in1, const T *in2)
     {
-        scramble((T*)out,   in1, n, 2);
-        scramble((T*)out+1, in2, n, 2);
+        const int *order = impl->input_order();
+        scramble((T*)out,   in1, n, order, 2);
+        scramble((T*)out+1, in2, n, order, 2);
         impl->template transform<false>((T*)out);
     }
 
     int size() const noexcept { return n; }
-    explicit operator bool() const noexcept { return impl; }
+    explicit operator bool() const noexcept { return impl != nullptr; }
 
 private:
     int n = 0;
-    FFTImplPtr<T> impl;
+    FFTImplPtr<T> impl, natural;
 };
 
+///@brief Sets the policy by which plans are kept after the last FFT object using them is gone
+///@param policy retention policy; PlanRetention::Weak (the default) releases all retained plans
+///@param budget_bytes for PlanRetention::LRU, approximate amount of memory that the retained plans
+///                    may refer to; least recently used plans are released above it.
+///                    A plan of size N is charged N complex numbers, about the size of its twiddle
+///                    factors, which are freed with the last plan that uses them.
+inline void SetPlanRetention(PlanRetention policy, size_t budget_bytes = 0)
+{
+    impl::PlanCache::instance().set_policy(policy, budget_bytes);
+}
+
+///@brief Builds 1D FFT plans, including their twiddle factors, ahead of time
+///
+///Combine with PlanRetention::Pin or PlanRetention::LRU to have the plans ready for
+///FFT objects created later; with PlanRetention::Weak they are released again on return.
+///@param sizes transform sizes
+template <class T>
+void PrewarmPlans(const std::vector<int> &sizes, FFTAlgorithm algorithm = FFTAlgorithm::Default)
+{
+    for (int n : sizes)
+    {
+        FFT<T> fft(n, algorithm);
+        // plans build their implementation on first use
+        std::vector<std::complex<T>> in(n), out(n);
+        fft.template transform<false>(out.data(), in.data());
+        fft.template transform_no_scramble<false>(out.data());
+    }
+}
+
 ///@brief Column-wise 1D FFT for multiple columns
 ///@tparam T scalar type
 template <class T, FFTVertImplFactory<T> *factory = backend::GetVertImpl>
@@ -163,7 +229,7 @@ struct FFTVert
     }
 
     int size() const noexcept { return n; }
-    explicit operator bool() const noexcept { return impl; }
+    explicit operator bool() const noexcept { return impl != nullptr; }
 
 private:
     int n = 0;
@@ -188,13 +254,47 @@ public:
     }
 
     int size() const noexcept { return n; }
-    explicit operator bool() const noexcept { return impl; }
+    explicit operator bool() const noexcept { return impl != nullptr; }
 
 private:
     int n = 0;
     std::shared_ptr<impl::FFTDITBase<T>> impl;
 };
 
+///@brief A 1D decimation-in-frequency FFT for power-of-two sizes
+///
+///Takes naturally ordered input and produces bit-reversed output, which is the order
+///expected by FFT::transform_no_scramble. A forward transform with FFTDIF, a pointwise
+///operation and FFT::transform_no_scramble<true> compute a convolution without reordering
+///the data at all.
+///@tparam T scalar type
+template <class T, FFTDIFImplFactory<T> *factory = backend::GetDIFImpl>
+struct FFTDIF
+{
+    FFTDIF()=default;
+    explicit FFTDIF(int n)
+    {
+        impl = factory(n, T());
+        this->n = n;
+    }
+
+    ///@brief Computes transform in-place; the output is in bit-reversed order
+    ///@tparam inv if true, computes inverse transform
+    ///@param inout data array
+    template <bool inv>
+    void transform(std::complex<T> *inout)
+    {
+        impl->template transform<inv>((T*)inout);
+    }
+
+    int size() const noexcept { return n; }
+    explicit operator bool() const noexcept { return impl != nullptr; }
+
+private:
+    int n = 0;
+    FFTDIFImplPtr<T> impl;
+};
+
 ///@brief 2D FFT
 ///@tparam T scalar type
 template <class T>
@@ -247,6 +347,7 @@ private:
 } // genfft
 
 #include "FFTReal.h"
+#include "FFTConvolve.h"
 
 
 #endif /* GENFFT_FFT_H */
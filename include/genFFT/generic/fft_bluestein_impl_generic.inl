@@ -0,0 +1,148 @@
+/*
+Copyright 2026 Michal Zientkiewicz
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Bluestein (chirp-z) FFT for arbitrary sizes
+//
+// The DFT is rewritten as a convolution with a chirp exp(-i*pi*k^2/n),
+// which is computed with power-of-two transforms of size m >= 2n-1.
+// The spectrum of the chirp is precomputed, so each transform costs
+// two power-of-two FFTs of size m plus O(m) pointwise work. The forward one is
+// a decimation-in-frequency transform, whose bit-reversed output is what the
+// inverse one takes, so the data is never reordered.
+// The input is expected in natural order; the m-point work array is
+// per-thread scratch memory (ThreadScratch).
+
+/// @brief Size of the power-of-two transforms used by FFTBluestein for an n-point FFT
+inline int bluestein_size(int n)
+{
+    int m = 1;
+    while (m < 2*n - 1)
+        m <<= 1;
+    return m;
+}
+
+inline bool is_bluestein_size(int n)
+{
+    return n > 1 && n <= (1<<22);
+}
+
+template <class T>
+struct FFTBluestein : impl::FFTBase<T>
+{
+    /// @param n    transform size
+    /// @param pow2 power-of-two transform of size bluestein_size(n), with bit-reversed input
+    /// @param dif  decimation-in-frequency transform of size bluestein_size(n), with bit-reversed output
+    FFTBluestein(int n, std::shared_ptr<impl::FFTBase<T>> pow2, std::shared_ptr<impl::FFTDIFBase<T>> dif)
+    : n(n), m(bluestein_size(n)), pow2(std::move(pow2)), dif(std::move(dif))
+    {
+        assert(is_bluestein_size(n));
+        chirp = aligned_alloc_T<std::complex<T>>(n, 32);
+        spectrum = aligned_alloc_T<std::complex<T>>(2*(size_t)m, 32);
+
+        for (int k = 0; k < n; k++)
+        {
+            // k^2 mod 2n keeps the angle small and accurate
+            double a = M_PI * (double)((long long)k * k % (2*n)) / n;
+            chirp[k] = { T(std::cos(a)), T(-std::sin(a)) };
+        }
+
+        // Kernels conj(chirp) for the forward and chirp for the inverse transform,
+        // wrapped around for negative indices and scaled by 1/m to compensate for
+        // the unnormalized inverse transform. The spectra are kept in bit-reversed order,
+        // as the DIF transform produces it and the inverse pow2 transform takes it.
+        const T scale = T(1) / m;
+        for (int inv = 0; inv < 2; inv++)
+        {
+            std::complex<T> *kernel = spectrum + (size_t)inv*m;
+            std::fill(kernel, kernel + m, std::complex<T>());
+            for (int k = 0; k < n; k++)
+            {
+                kernel[k] = (inv ? chirp[k] : conj(chirp[k])) * scale;
+                if (k)
+                    kernel[m - k] = kernel[k];
+            }
+            this->dif->template transform<false>((T*)kernel);
+        }
+    }
+
+    ~FFTBluestein()
+    {
+        free(chirp);
+        free(spectrum);
+    }
+
+    FFTBluestein(const FFTBluestein &) = delete;
+    FFTBluestein &operator=(const FFTBluestein &) = delete;
+
+    // the input is in natural order, so no transform needs to reorder it
+    void forward(T *data) override { transform_impl<false>(data, data); }
+    void inverse(T *data) override { transform_impl<true>(data, data); }
+    void forward(T *out, const T *in) override { transform_impl<false>(out, in); }
+    void inverse(T *out, const T *in) override { transform_impl<true>(out, in); }
+    void forward_inplace(T *data) override { transform_impl<false>(data, data); }
+    void inverse_inplace(T *data) override { transform_impl<true>(data, data); }
+
+    int size() const noexcept override { return n; }
+
+    static std::shared_ptr<impl::FFTBase<T>> GetInstance(int n, std::shared_ptr<impl::FFTBase<T>> pow2,
+                                                         std::shared_ptr<impl::FFTDIFBase<T>> dif)
+    {
+        return impl::PlanRegistry<impl::FFTBase<T>>::instance().template get<FFTBluestein>(
+            n, 2*pow2->size()*sizeof(complex<T>),
+            [&]() { return new FFTBluestein(n, std::move(pow2), std::move(dif)); });
+    }
+
+private:
+    template <bool inv>
+    void transform_impl(T *out, const T *in)
+    {
+        const std::complex<T> *x = (const std::complex<T> *)in;
+        std::complex<T> *y = (std::complex<T> *)out;
+        std::complex<T> *a = ThreadScratch<FFTBluestein>::template get<std::complex<T>>(m);
+
+        for (int k = 0; k < n; k++)
+            a[k] = x[k] * (inv ? conj(chirp[k]) : chirp[k]);
+        for (int k = n; k < m; k++)
+            a[k] = 0;
+        // natural order in, bit-reversed out - the order of the kernel spectrum and of the inverse's input
+        dif->template transform<false>((T*)a);
+
+        const std::complex<T> *K = spectrum + (inv ? m : 0);
+        for (int k = 0; k < m; k++)
+            a[k] *= K[k];
+
+        pow2->template transform<true>((T*)a);
+        for (int k = 0; k < n; k++)
+            y[k] = a[k] * (inv ? conj(chirp[k]) : chirp[k]);
+    }
+
+    int n, m;
+    std::shared_ptr<impl::FFTBase<T>> pow2;
+    std::shared_ptr<impl::FFTDIFBase<T>> dif;
+    std::complex<T> *chirp = nullptr;
+    /// kernel spectra for the forward and inverse transform, m values each, in bit-reversed order
+    std::complex<T> *spectrum = nullptr;
+};
@@ -0,0 +1,196 @@
+/*
+Copyright 2026 Michal Zientkiewicz
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Decimation-in-frequency FFT for power-of-two sizes
+//
+// The butterflies are applied before the sub-transforms, so the input is read in
+// natural order and the output is left in bit-reversed order - the exact opposite
+// of the DIT levels, whose in-place transform expects bit-reversed input.
+
+template <int N, class T>
+struct FFTDIFGeneric
+{
+    FFTDIFGeneric<N/2, T> next;
+    template <bool inv>
+    void transform_impl(T *data)
+    {
+#ifdef FFT_OPENMP_SIMD
+        #pragma omp simd
+#endif
+        for (int i=0; i<N; i+=2)
+        {
+            T wr = twiddle[i];
+            T wi = twiddle[i+1];
+            T dr = data[i]   - data[i+N];
+            T di = data[i+1] - data[i+N+1];
+            data[i]     += data[i+N];
+            data[i+1]   += data[i+N+1];
+            data[i+N]   = inv ? dr*wr + di*wi : dr*wr - di*wi;
+            data[i+N+1] = inv ? di*wr - dr*wi : dr*wi + di*wr;
+        }
+
+        next.template transform_impl<inv>(data);
+        next.template transform_impl<inv>(data+N);
+    }
+
+    const SharedTwiddle<N, T> twiddle;
+};
+
+template <class T>
+struct FFTDIFGeneric<4, T>
+{
+    template <bool inv>
+    void transform_impl(T *data)
+    {
+        // x0 +- x2, x1 +- x3
+        T t0r = data[0] + data[4], t0i = data[1] + data[5];
+        T t1r = data[0] - data[4], t1i = data[1] - data[5];
+        T t2r = data[2] + data[6], t2i = data[3] + data[7];
+        T dr  = data[2] - data[6], di  = data[3] - data[7];
+        // (x1 - x3) * -i, or * i for the inverse transform
+        T t3r = inv ? -di : di;
+        T t3i = inv ? dr : -dr;
+
+        data[0] = t0r + t2r;
+        data[1] = t0i + t2i;
+        data[2] = t0r - t2r;
+        data[3] = t0i - t2i;
+        data[4] = t1r + t3r;
+        data[5] = t1i + t3i;
+        data[6] = t1r - t3r;
+        data[7] = t1i - t3i;
+    }
+};
+
+template <class T>
+struct FFTDIFGeneric<2, T> : FFTGeneric<2, T> {};
+
+template <class T>
+struct FFTDIFGeneric<1, T> : FFTGeneric<1, T> {};
+
+/// @brief Runtime-sized DIF FFT: radix-2 levels above a compile-time leaf transform
+template <class T>
+struct FFTDIFGeneric<-1, T>
+{
+    FFTDIFGeneric(int n, std::shared_ptr<impl::FFTDIFBase<T>> leaf) : N(n), leaf(std::move(leaf))
+    {
+        for (int size = this->leaf->size(); size <= N/2; size *= 2)
+            twiddle.emplace_back(2*size);
+        assert(this->leaf->size() << twiddle.size() == N);
+    }
+
+    template <bool inv>
+    void transform_impl(T *data)
+    {
+        transform_level<inv>(data, (int)twiddle.size() - 1);
+    }
+
+    int size() const noexcept { return N; }
+
+    /// @brief Size of the leaf transform used for an n-point FFT
+    static int leaf_size(int n)
+    {
+        return n < (1<<GENFFT_MAX_STATIC_LOG2) ? n : (1<<GENFFT_MAX_STATIC_LOG2);
+    }
+
+private:
+    template <bool inv>
+    void transform_level(T *data, int level)
+    {
+        if (level < 0)
+        {
+            leaf->template transform<inv>(data);
+            return;
+        }
+        const SharedTwiddle<-1, T> &tw = twiddle[level];
+        const int half = tw.N;
+
+#ifdef FFT_OPENMP_SIMD
+        #pragma omp simd
+#endif
+        for (int i=0; i<half; i+=2)
+        {
+            T wr = tw[i];
+            T wi = tw[i+1];
+            T dr = data[i]   - data[i+half];
+            T di = data[i+1] - data[i+half+1];
+            data[i]        += data[i+half];
+            data[i+1]      += data[i+half+1];
+            data[i+half]   = inv ? dr*wr + di*wi : dr*wr - di*wi;
+            data[i+half+1] = inv ? di*wr - dr*wi : dr*wi + di*wr;
+        }
+
+        transform_level<inv>(data, level-1);
+        transform_level<inv>(data + half, level-1);
+    }
+
+    int N;
+    std::shared_ptr<impl::FFTDIFBase<T>> leaf;
+    std::vector<SharedTwiddle<-1, T>> twiddle;
+};
+
+template <class T>
+inline std::shared_ptr<impl::FFTDIFBase<T>> GetDIFImpl(int n, T)
+{
+    // DIF transforms support power-of-two sizes only
+    if (n <= 0 || (n & (n-1)) != 0)
+        return nullptr;
+    switch (n)
+    {
+#define SELECT_FFT_LEVEL(x) case (1<<x): \
+            if (x <= GENFFT_MAX_STATIC_LOG2) \
+                return impl::FFTDIFLevel<(1<<impl::static_log2(x)), T, FFTDIFGeneric<(1<<impl::static_log2(x)), T>>::GetInstance(); \
+            break;
+            SELECT_FFT_LEVEL(0);
+            SELECT_FFT_LEVEL(1);
+            SELECT_FFT_LEVEL(2);
+            SELECT_FFT_LEVEL(3);
+            SELECT_FFT_LEVEL(4);
+            SELECT_FFT_LEVEL(5);
+            SELECT_FFT_LEVEL(6);
+            SELECT_FFT_LEVEL(7);
+            SELECT_FFT_LEVEL(8);
+            SELECT_FFT_LEVEL(9);
+            SELECT_FFT_LEVEL(10);
+            SELECT_FFT_LEVEL(11);
+            SELECT_FFT_LEVEL(12);
+            SELECT_FFT_LEVEL(13);
+            SELECT_FFT_LEVEL(14);
+            SELECT_FFT_LEVEL(15);
+            SELECT_FFT_LEVEL(16);
+            SELECT_FFT_LEVEL(17);
+            SELECT_FFT_LEVEL(18);
+            SELECT_FFT_LEVEL(19);
+            SELECT_FFT_LEVEL(20);
+            SELECT_FFT_LEVEL(21);
+            SELECT_FFT_LEVEL(22);
+            SELECT_FFT_LEVEL(23);
+#undef SELECT_FFT_LEVEL
+        default:
+            break;
+    }
+    return impl::FFTDIFLevel<-1, T, FFTDIFGeneric<-1, T>>::GetInstance(n, GetDIFImpl(FFTDIFGeneric<-1, T>::leaf_size(n), T()));
+}
@@ -60,6 +60,28 @@ void adjust_DIT_impl(std::complex<T> *F, const std::complex<T> *Z, int N, bool h
             F[i] = conj(F[N - i]);
 }
 
+/// @brief Inverse of adjust_DIT_impl: computes Z (N/2 values) from F[0..N/2]; Z and F may alias
+template <typename T>
+void adjust_DIT_inverse_impl(std::complex<T> *Z, const std::complex<T> *F, int N, const T *twiddle) noexcept
+{
+    int halfN = N >> 1;
+    T zeroval = F[0].real();
+    T centerval = F[halfN].real();
+    auto quarterval = conj(F[halfN/2]) * T(2);
+    for (int i = 1, j = halfN-1; i < halfN/2; i++, j--)
+    {
+        // Z[i] = E + i*conj(W^i)*O, with E and O scaled by 2
+        std::complex<T> A = F[i] + conj(F[j]);
+        std::complex<T> B = F[i] - conj(F[j]);
+        std::complex<T> ti = { twiddle[2*i], -twiddle[2*i+1] };
+        Z[i] = A - ti*B;
+        Z[j] = conj(A + ti*B);
+    }
+    Z[0] = { zeroval + centerval, zeroval - centerval };
+    if (halfN > 1)
+        Z[halfN/2] = quarterval;
+}
+
 template <int N, typename T>
 struct FFTDIT : impl::FFTDITBase<T>
 {
@@ -76,9 +98,15 @@ struct FFTDIT : impl::FFTDITBase<T>
         adjust_DIT_impl((std::complex<T>*)F, (const std::complex<T>*)Z, n, half, twiddle.t);
     }
 
+    void apply_inverse(T *Z, const T *F) const noexcept override
+    {
+        adjust_DIT_inverse_impl((std::complex<T>*)Z, (const std::complex<T>*)F, n, twiddle.t);
+    }
+
 private:
     int n = N > 0 ? N : 0;
-    DITTwiddle<N, T> twiddle;
+    // kept out of the object, so that a plan for a large size is not one huge allocation
+    DITTwiddle<-1, T> twiddle;
 
 public:
     void *operator new(size_t count)
@@ -92,28 +120,13 @@ public:
 
     static std::shared_ptr<impl::FFTDITBase<T>> GetInstance(int n)
     {
-        if (N < 0)
-            return std::shared_ptr<impl::FFTDITBase<T>>(new FFTDIT(n));
-
-        assert(n == N);
+        assert(n == N || N < 0);
 
         // This object is immutable, we can use cached variant
-
-        auto shptr = instance.lock();
-        if (!shptr)
-        {
-            shptr.reset(new FFTDIT(n));
-            instance = shptr;
-        }
-        return shptr;
+        return impl::PlanRegistry<impl::FFTDITBase<T>>::instance().template get<FFTDIT>(n, n*sizeof(T), [n]() { return new FFTDIT(n); });
     }
-private:
-    static std::weak_ptr<impl::FFTDITBase<T>> instance;
 };
 
-template <int N, class T>
-std::weak_ptr<impl::FFTDITBase<T>> FFTDIT<N, T>::instance;
-
 template <class T>
 inline std::shared_ptr<impl::FFTDITBase<T>> GetDITImpl(int n, T)
 {
@@ -121,7 +134,10 @@ inline std::shared_ptr<impl::FFTDITBase<T>> GetDITImpl(int n, T)
     switch (n)
     {
         // Use cached variants for some powers of 2
-#define SELECT_FFT_LEVEL(x) case (1<<x): return FFTDIT<(1<<x), T>::GetInstance(n);
+#define SELECT_FFT_LEVEL(x) case (1<<x): \
+            if (x <= GENFFT_MAX_STATIC_LOG2) \
+                return FFTDIT<(1<<impl::static_log2(x)), T>::GetInstance(n); \
+            break;
         SELECT_FFT_LEVEL(0);
         SELECT_FFT_LEVEL(1);
         SELECT_FFT_LEVEL(2);
@@ -148,6 +164,7 @@ inline std::shared_ptr<impl::FFTDITBase<T>> GetDITImpl(int n, T)
         SELECT_FFT_LEVEL(23);
 #undef SELECT_FFT_LEVEL
     default:
-        return FFTDIT<-1, T>::GetInstance(n);
+        break;
     }
+    return FFTDIT<-1, T>::GetInstance(n);
 }
@@ -0,0 +1,253 @@
+/*
+Copyright 2026 Michal Zientkiewicz
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Four-step (Bailey) FFT for power-of-two sizes that exceed the cache
+//
+// The n-point transform is computed on an R x C matrix (n = R*C) with
+// R*C-point passes that only touch cache-sized blocks of the signal,
+// instead of streaming it through memory at every level of the recursion.
+// Column FFTs are done on narrow column blocks copied to a tile with a padded
+// stride, so that they don't suffer from cache set conflicts of the
+// power-of-two row stride.
+//
+// In-place transform (input in bit-reversed order, as for FFTLevel):
+// bit-reversing an index i*C+j yields bitrev(j)*R + bitrev(i), so each row holds
+// a bit-reversed row FFT input and the rows are in bit-reversed order.
+// 1. R row FFTs of size C
+// 2. multiplication by twiddle factors W_n^(bitrev(i)*k)
+// 3. C column FFTs of size R (FFTVert); the output is in natural order
+//
+// Out-of-place transform (input in natural order), which needs no
+// element-wise bit reversal of the whole signal:
+// 1. copy the input rows in bit-reversed row order (whole rows at a time)
+// 2. C column FFTs of size R, followed by twiddle factors W_n^(k*j)
+// 3. R row FFTs of size C, written transposed to the output
+//
+// The tiles and the out-of-place work area live in per-thread scratch memory,
+// which is allocated by the first transform on each thread.
+
+#ifndef GENFFT_FOUR_STEP_MIN_SIZE
+/// @brief Smallest power-of-two size for which GetImpl uses the four-step algorithm
+#define GENFFT_FOUR_STEP_MIN_SIZE (1<<20)
+#endif
+
+inline bool is_four_step_size(int n)
+{
+    return n >= GENFFT_FOUR_STEP_MIN_SIZE && n >= 4 && (n & (n-1)) == 0;
+}
+
+/// @brief Row length of the four-step matrix for an n-point transform
+inline int four_step_cols(int n)
+{
+    int log2n = 0;
+    while ((1 << log2n) < n)
+        log2n++;
+    return 1 << ((log2n + 1) / 2);
+}
+
+template <class T>
+struct FFTFourStep : impl::FFTBase<T>
+{
+    /// @param n    transform size
+    /// @param row  FFT of size four_step_cols(n)
+    /// @param col  vertical FFT of size n / four_step_cols(n)
+    FFTFourStep(int n, std::shared_ptr<impl::FFTBase<T>> row, std::shared_ptr<impl::FFTVertBase<T>> col)
+    : n(n), cols(four_step_cols(n)), rows(n / cols), row(std::move(row)), col(std::move(col))
+    {
+        assert(n >= 4 && (n & (n-1)) == 0);
+        log2cols = 0;
+        while ((1 << log2cols) < cols)
+            log2cols++;
+        int log2rows = 0;
+        while ((1 << log2rows) < rows)
+            log2rows++;
+        width = cols < block_cols ? cols : (int)block_cols;
+
+        // W_n^m is split into W_n^(a*C) * W_n^b, with m = a*C + b
+        coarse = aligned_alloc_T<T>(2*rows, 32);
+        fine = aligned_alloc_T<T>(2*cols, 32);
+        for (int a = 0; a < rows; a++)
+        {
+            double angle = 2 * M_PI * a / rows;
+            coarse[2*a]   = T(std::cos(angle));
+            coarse[2*a+1] = T(-std::sin(angle));
+        }
+        for (int b = 0; b < cols; b++)
+        {
+            double angle = 2 * M_PI * b / n;
+            fine[2*b]   = T(std::cos(angle));
+            fine[2*b+1] = T(-std::sin(angle));
+        }
+
+        block_twiddle = aligned_alloc_T<T>(2*rows*width, 32);
+        row_index.resize(rows);
+        for (int r = 0; r < rows; r++)
+        {
+            int rev = 0;
+            for (int b = 0; b < log2rows; b++)
+                rev |= ((r >> b) & 1) << (log2rows - 1 - b);
+            row_index[r] = rev;
+            for (int k = 0; k < width; k++)
+            {
+                double angle = 2 * M_PI * (double)((r * k) & (n - 1)) / n;
+                block_twiddle[2*(r*width + k)]   = T(std::cos(angle));
+                block_twiddle[2*(r*width + k)+1] = T(-std::sin(angle));
+            }
+        }
+    }
+
+    ~FFTFourStep()
+    {
+        free(coarse);
+        free(fine);
+        free(block_twiddle);
+    }
+
+    FFTFourStep(const FFTFourStep &) = delete;
+    FFTFourStep &operator=(const FFTFourStep &) = delete;
+
+    void forward(T *data) override { transform_impl<false>(data); }
+    void inverse(T *data) override { transform_impl<true>(data); }
+    void forward(T *out, const T *in) override { transform_impl<false>(out, in); }
+    void inverse(T *out, const T *in) override { transform_impl<true>(out, in); }
+
+    int size() const noexcept override { return n; }
+
+    static std::shared_ptr<impl::FFTBase<T>> GetInstance(int n,
+        std::shared_ptr<impl::FFTBase<T>> row, std::shared_ptr<impl::FFTVertBase<T>> col)
+    {
+        return impl::PlanRegistry<impl::FFTBase<T>>::instance().template get<FFTFourStep>(
+            n, n*sizeof(complex<T>), [&]() { return new FFTFourStep(n, std::move(row), std::move(col)); });
+    }
+
+private:
+    /// @brief Maximum width, in complex numbers, of the column blocks
+    enum { block_cols = 32 };
+    /// @brief Padding, in complex numbers, of the column tile rows
+    enum { tile_padding = 4 };
+
+    /// @brief Computes dst[k] = src[k] * W_n^(r*(k0+k)) for k < width
+    template <bool inv>
+    void twiddle_span(T *dst, const T *src, int r, int k0) const
+    {
+        const int m = (r * k0) & (n - 1);
+        const T *c = coarse + 2*(m >> log2cols);
+        const T *f = fine + 2*(m & (cols - 1));
+        const T br = c[0]*f[0] - c[1]*f[1];
+        const T bi = c[0]*f[1] + c[1]*f[0];
+        const T *w = block_twiddle + 2*r*width;
+#ifdef FFT_OPENMP_SIMD
+        #pragma omp simd
+#endif
+        for (int k = 0; k < width; k++)
+        {
+            T wr = br*w[2*k] - bi*w[2*k+1];
+            T wi = br*w[2*k+1] + bi*w[2*k];
+            T re = src[2*k], im = src[2*k+1];
+            dst[2*k]   = inv ? re*wr + im*wi : re*wr - im*wi;
+            dst[2*k+1] = inv ? im*wr - re*wi : im*wr + re*wi;
+        }
+    }
+
+    template <bool inv>
+    void transform_impl(T *data)
+    {
+        for (int i = 0; i < rows; i++)
+            row->template transform<inv>(data + 2*(ptrdiff_t)i*cols);
+
+        const int tile_stride = width + tile_padding;
+        T *tile = ThreadScratch<FFTFourStep>::template get<T>(2*rows*tile_stride);
+        for (int k0 = 0; k0 < cols; k0 += width)
+        {
+            for (int i = 0; i < rows; i++)
+                twiddle_span<inv>(tile + 2*i*tile_stride, data + 2*((ptrdiff_t)i*cols + k0), row_index[i], k0);
+
+            col->template transform<inv>(tile, 2*tile_stride, width);
+
+            for (int i = 0; i < rows; i++)
+                copy_span(data + 2*((ptrdiff_t)i*cols + k0), tile + 2*i*tile_stride);
+        }
+    }
+
+    template <bool inv>
+    void transform_impl(T *out, const T *in)
+    {
+        const int tile_stride = width + tile_padding;
+        const int group = block_cols;
+        // work, tile and row_buf, each starting at a 32-byte boundary
+        const size_t tile_size = align<size_t>(2*rows*tile_stride, 8);
+        T *work = ThreadScratch<FFTFourStep>::template get<T>(2*(size_t)n + tile_size + 2*group*cols);
+        T *tile = work + 2*(size_t)n;
+        T *row_buf = tile + tile_size;
+
+        for (int k0 = 0; k0 < cols; k0 += width)
+        {
+            for (int i = 0; i < rows; i++)
+                copy_span(tile + 2*i*tile_stride, in + 2*((ptrdiff_t)row_index[i]*cols + k0));
+
+            col->template transform<inv>(tile, 2*tile_stride, width);
+
+            for (int i = 0; i < rows; i++)
+                twiddle_span<inv>(work + 2*((ptrdiff_t)i*cols + k0), tile + 2*i*tile_stride, i, k0);
+        }
+
+        // Row FFTs in groups of rows, so that the transposed stores write whole cache lines
+        for (int i0 = 0; i0 < rows; i0 += group)
+        {
+            const int count = rows - i0 < group ? rows - i0 : group;
+            for (int i = 0; i < count; i++)
+            {
+                T *buf = row_buf + 2*i*cols;
+                scramble((complex<T>*)buf, (const complex<T>*)(work + 2*(ptrdiff_t)(i0 + i)*cols), cols);
+                row->template transform<inv>(buf);
+            }
+            for (int k = 0; k < cols; k++)
+            {
+                T *dst = out + 2*((ptrdiff_t)k*rows + i0);
+                for (int i = 0; i < count; i++)
+                {
+                    dst[2*i]   = row_buf[2*(i*cols + k)];
+                    dst[2*i+1] = row_buf[2*(i*cols + k)+1];
+                }
+            }
+        }
+    }
+
+    void copy_span(T *dst, const T *src) const
+    {
+        for (int k = 0; k < 2*width; k++)
+            dst[k] = src[k];
+    }
+
+    int n, cols, rows, log2cols, width;
+    std::shared_ptr<impl::FFTBase<T>> row;
+    std::shared_ptr<impl::FFTVertBase<T>> col;
+    /// @brief bitrev(i) for row i
+    std::vector<int> row_index;
+    T *coarse = nullptr, *fine = nullptr;
+    /// @brief W_n^(r*k) for r < R and k < width
+    T *block_twiddle = nullptr;
+};
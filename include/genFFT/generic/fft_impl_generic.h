@@ -28,7 +28,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define GENFFT_IMPL_GENERIC_H
 
 #include <cassert>
+#include <complex>
+#include <vector>
 #include "../FFTTwiddle.h"
+#include "../FFTLevel.h"
 
 namespace genfft {
 namespace impl_generic {
@@ -59,7 +62,7 @@ struct FFTGeneric
         }
     }
 
-    const Twiddle<N, T> twiddle;
+    const SharedTwiddle<N, T> twiddle;
 };
 
 
@@ -119,6 +122,66 @@ struct FFTGeneric<1, T>
     void transform_impl(T *) {}
 };
 
+/// @brief Runtime-sized FFT: radix-2 levels on top of a compile-time leaf transform
+template <class T>
+struct FFTGeneric<-1, T>
+{
+    FFTGeneric(int n, std::shared_ptr<impl::FFTBase<T>> leaf) : N(n), leaf(std::move(leaf))
+    {
+        for (int size = this->leaf->size(); size <= N/2; size *= 2)
+            twiddle.emplace_back(2*size);
+        assert(this->leaf->size() << twiddle.size() == N);
+    }
+
+    template <bool inv>
+    void transform_impl(T *data)
+    {
+        transform_level<inv>(data, (int)twiddle.size() - 1);
+    }
+
+    int size() const noexcept { return N; }
+
+    /// @brief Size of the leaf transform used for an n-point FFT
+    static int leaf_size(int n)
+    {
+        return n < (1<<GENFFT_MAX_STATIC_LOG2) ? n : (1<<GENFFT_MAX_STATIC_LOG2);
+    }
+
+private:
+    template <bool inv>
+    void transform_level(T *data, int level)
+    {
+        if (level < 0)
+        {
+            leaf->template transform<inv>(data);
+            return;
+        }
+        const SharedTwiddle<-1, T> &tw = twiddle[level];
+        const int half = tw.N;
+        transform_level<inv>(data, level-1);
+        transform_level<inv>(data + half, level-1);
+
+#ifdef FFT_OPENMP_SIMD
+        #pragma omp simd
+#endif
+        for (int i=0; i<half; i+=2)
+        {
+            T wr = tw[i];
+            T wi = tw[i+1];
+            T tempr = inv ? data[i+half]*wr + data[i+half+1]*wi : data[i+half]*wr - data[i+half+1]*wi;
+            T tempi = inv ? data[i+half+1]*wr - data[i+half]*wi : data[i+half]*wi + data[i+half+1]*wr;
+            data[i+half]   = data[i]-tempr;
+            data[i+half+1] = data[i+1]-tempi;
+            data[i]     += tempr;
+            data[i+1]   += tempi;
+        }
+    }
+
+    int N;
+    std::shared_ptr<impl::FFTBase<T>> leaf;
+    std::vector<SharedTwiddle<-1, T>> twiddle;
+};
+
 
 
 template <int N, class T>
@@ -164,7 +227,7 @@ struct FFTVertGeneric
         }
     }
 
-    const Twiddle<N, T> twiddle;
+    const SharedTwiddle<N, T> twiddle;
 };
 
 
@@ -242,12 +305,99 @@ struct FFTVertGeneric<1, T>
     void transform_impl(T*, int, int) {}
 };
 
+/// @brief Runtime-sized vertical FFT: radix-2 levels on top of a compile-time leaf transform
+template <class T>
+struct FFTVertGeneric<-1, T>
+{
+    FFTVertGeneric(int n, std::shared_ptr<impl::FFTVertBase<T>> leaf, int leaf_size) : N(n), leaf(std::move(leaf))
+    {
+        for (int size = leaf_size; size <= N/2; size *= 2)
+            twiddle.emplace_back(2*size);
+        assert(leaf_size << twiddle.size() == N);
+    }
+
+    template <bool inv>
+    void transform_impl(T *data, stride_t stride, index_t cols)
+    {
+        index_t next_col = cols;
+        // Process the input in vertical spans, 32 complex numbers wide.
+        // The last span may be wider, up to 48.
+        for (index_t col=0; col<cols; col=next_col)
+        {
+            next_col = cols - col >= 48 ? col + 32 : cols;
+            transform_span<inv>(data + 2*col, stride, next_col - col, (int)twiddle.size() - 1);
+        }
+    }
+
+    /// @brief Size of the leaf transform used for an n-point FFT
+    static int leaf_size(int n)
+    {
+        return n < (1<<GENFFT_MAX_STATIC_LOG2) ? n : (1<<GENFFT_MAX_STATIC_LOG2);
+    }
+
+private:
+    template <bool inv>
+    void transform_span(T *data, stride_t stride, index_t cols, int level)
+    {
+        if (level < 0)
+        {
+            leaf->template transform<inv>(data, stride, cols);
+            return;
+        }
+        const SharedTwiddle<-1, T> &tw = twiddle[level];
+        const int half_rows = tw.N/2;
+        const stride_t half = half_rows*stride;
+        transform_span<inv>(data,        stride, cols, level-1);
+        transform_span<inv>(data + half, stride, cols, level-1);
+
+        for (int i=0; i<half_rows; i++)
+        {
+            T wr = tw[2*i];
+            T wi = tw[2*i+1];
+            T *even = data + i*stride;
+            T *odd =  even + half;
+#ifdef FFT_OPENMP_SIMD
+            #pragma omp simd
+#endif
+            for (index_t j=0; j<2*cols; j+=2)
+            {
+                T tempr, tempi;
+                tempr = inv ? odd[j]*wr + odd[j+1]*wi : odd[j]*wr - odd[j+1]*wi;
+                tempi = inv ? odd[j+1]*wr - odd[j]*wi : odd[j+1]*wr + odd[j]*wi;
+                odd[j]    = even[j]-tempr;
+                odd[j+1]  = even[j+1]-tempi;
+                even[j]   += tempr;
+                even[j+1] += tempi;
+            }
+        }
+    }
+
+    int N;
+    std::shared_ptr<impl::FFTVertBase<T>> leaf;
+    std::vector<SharedTwiddle<-1, T>> twiddle;
+};
+
+#include "fft_mixed_radix_impl_generic.inl"
+#include "fft_bluestein_impl_generic.inl"
+#include "fft_stockham_impl_generic.inl"
+#include "fft_four_step_impl_generic.inl"
+#include "fft_dif_impl_generic.inl"
+
+template <class T>
+inline std::shared_ptr<impl::FFTVertBase<T>> GetVertImpl(int n, T);
+
 template <class T>
 inline std::shared_ptr<impl::FFTBase<T>> GetImpl(int n, T)
 {
+    if (is_four_step_size(n))
+        return FFTFourStep<T>::GetInstance(n, GetImpl(four_step_cols(n), T()), GetVertImpl(n / four_step_cols(n), T()));
+
     switch (n)
     {
-#define SELECT_FFT_LEVEL(x) case (1<<x): return impl::FFTLevel<(1<<x), T, FFTGeneric<(1<<x), T>>::GetInstance();
+#define SELECT_FFT_LEVEL(x) case (1<<x): \
+            if (x <= GENFFT_MAX_STATIC_LOG2) \
+                return impl::FFTLevel<(1<<impl::static_log2(x)), T, FFTGeneric<(1<<impl::static_log2(x)), T>>::GetInstance(); \
+            break;
             SELECT_FFT_LEVEL(0);
             SELECT_FFT_LEVEL(1);
             SELECT_FFT_LEVEL(2);
@@ -274,8 +424,32 @@ inline std::shared_ptr<impl::FFTBase<T>> GetImpl(int n, T)
             SELECT_FFT_LEVEL(23);
 #undef SELECT_FFT_LEVEL
         default:
-            assert(!"unsupported size");
+            break;
     }
+
+    if (is_mixed_radix_size(n))
+        return FFTMixedRadix<T>::GetInstance(n, GetImpl(n & -n, T()));
+    if (n > 0 && (n & (n-1)) == 0)
+        return impl::FFTLevel<-1, T, FFTGeneric<-1, T>>::GetInstance(n, GetImpl(FFTGeneric<-1, T>::leaf_size(n), T()));
+    if (is_bluestein_size(n))
+        return FFTBluestein<T>::GetInstance(n, GetImpl(bluestein_size(n), T()), GetDIFImpl(bluestein_size(n), T()));
+    assert(!"unsupported size");
+    return nullptr;
+}
+
+/// @brief Plan for naturally ordered data - the default one, the generic backend has no wisdom
+template <class T>
+inline std::shared_ptr<impl::FFTBase<T>> GetTunedImpl(int n, T)
+{
+    return GetImpl(n, T());
+}
+
+template <class T>
+inline std::shared_ptr<impl::FFTBase<T>> GetStockhamImpl(int n, T)
+{
+    if (n >= 2 && (n & (n-1)) == 0)
+        return FFTStockham<T>::GetInstance(n);
+    return GetImpl(n, T());
 }
 
 template <class T>
@@ -283,7 +457,10 @@ inline std::shared_ptr<impl::FFTVertBase<T>> GetVertImpl(int n, T)
 {
     switch (n)
     {
-#define SELECT_FFT_LEVEL(x) case (1<<x): return impl::FFTVertLevel<(1<<x), T, FFTVertGeneric<(1<<x), T>>::GetInstance();
+#define SELECT_FFT_LEVEL(x) case (1<<x): \
+            if (x <= GENFFT_MAX_STATIC_LOG2) \
+                return impl::FFTVertLevel<(1<<impl::static_log2(x)), T, FFTVertGeneric<(1<<impl::static_log2(x)), T>>::GetInstance(); \
+            break;
             SELECT_FFT_LEVEL(0);
             SELECT_FFT_LEVEL(1);
             SELECT_FFT_LEVEL(2);
@@ -310,13 +487,22 @@ inline std::shared_ptr<impl::FFTVertBase<T>> GetVertImpl(int n, T)
             SELECT_FFT_LEVEL(23);
 #undef SELECT_FFT_LEVEL
         default:
-            assert(!"unsupported size");
+            break;
+    }
+
+    if (n > 0 && (n & (n-1)) == 0)
+    {
+        int leaf_size = FFTVertGeneric<-1, T>::leaf_size(n);
+        return impl::FFTVertLevel<-1, T, FFTVertGeneric<-1, T>>::GetInstance(n, GetVertImpl(leaf_size, T()), leaf_size);
     }
+    assert(!"unsupported size");
+    return nullptr;
 }
 
 }  // impl_generic
 }  // genfft
 
 #include "fft_dit_generic.h"
+#include "fft_pointwise_generic.h"
 
 #endif /* GENFFT_IMPL_GENERIC_H */
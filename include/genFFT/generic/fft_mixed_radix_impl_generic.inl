@@ -0,0 +1,274 @@
+/*
+Copyright 2026 Michal Zientkiewicz
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Mixed-radix FFT for sizes 2^a * 3^b * 5^c * 7^d
+//
+// The transform is a decimation in time: the power-of-two part is computed
+// by the regular power-of-two kernels on contiguous blocks and the odd factors
+// are applied as subsequent radix-3, -5 and -7 passes.
+// The input is expected in digit-reversed order - see FFTMixedRadix::input_order.
+
+inline bool is_mixed_radix_size(int n)
+{
+    if (n <= 1 || (n & (n-1)) == 0 || (n & -n) > (1<<23))
+        return false;
+    n /= (n & -n);
+    for (int p : { 3, 5, 7 })
+        while (n % p == 0)
+            n /= p;
+    return n == 1;
+}
+
+template <typename T>
+inline std::complex<T> complex_mul_scalar(std::complex<T> x, std::complex<T> w, bool inv)
+{
+    return inv ? x * conj(w) : x * w;
+}
+
+/// @brief Multiplies x by -i (or by i, if inv is true)
+template <bool inv, typename T>
+inline std::complex<T> rotate90(std::complex<T> x)
+{
+    return inv ? std::complex<T>(-x.imag(), x.real()) : std::complex<T>(x.imag(), -x.real());
+}
+
+/// @brief Computes a P-point DFT of x in place, P odd
+/// @param cs cos(2*pi*j*k/P) for j, k in 1..(P-1)/2, stored at [(j-1)*(P-1)/2 + k-1]
+/// @param sn sin(2*pi*j*k/P), same layout as cs
+/// V is either std::complex<T> or a SIMD vector of interleaved complex numbers
+/// and C is a real scalar or a SIMD vector with the constant broadcast.
+template <int P, bool inv, class V, class C>
+inline void odd_radix_butterfly(V *x, const C *cs, const C *sn)
+{
+    constexpr int H = (P-1)/2;
+    V s[H], d[H], y[P];
+    y[0] = x[0];
+    for (int j = 0; j < H; j++)
+    {
+        s[j] = x[j+1] + x[P-1-j];
+        d[j] = x[j+1] - x[P-1-j];
+        y[0] = y[0] + s[j];
+    }
+    for (int k = 0; k < H; k++)
+    {
+        V a = x[0] + s[0] * cs[k];
+        V b = d[0] * sn[k];
+        for (int j = 1; j < H; j++)
+        {
+            a = a + s[j] * cs[j*H + k];
+            b = b + d[j] * sn[j*H + k];
+        }
+        b = rotate90<inv>(b);
+        y[k+1]   = a + b;
+        y[P-1-k] = a - b;
+    }
+    for (int k = 0; k < P; k++)
+        x[k] = y[k];
+}
+
+/// @brief Applies radix-P butterflies with indices [k0, m) to a single group of P*m elements
+template <int P, bool inv, typename T>
+inline void radix_butterflies_scalar(T *group, int m, int k0, const T *twiddle, const T *cs, const T *sn)
+{
+    std::complex<T> *x = (std::complex<T> *)group;
+    const std::complex<T> *w = (const std::complex<T> *)twiddle;
+    for (int k = k0; k < m; k++)
+    {
+        std::complex<T> v[P];
+        v[0] = x[k];
+        for (int q = 1; q < P; q++)
+            v[q] = complex_mul_scalar(x[q*m + k], w[(q-1)*m + k], inv);
+        odd_radix_butterfly<P, inv>(v, cs, sn);
+        for (int q = 0; q < P; q++)
+            x[q*m + k] = v[q];
+    }
+}
+
+template <typename T>
+struct MixedRadixPass
+{
+    /// @brief Combines P consecutive transforms of size m into transforms of size P*m
+    /// @param data     interleaved complex data, n complex numbers
+    /// @param twiddle  W(P*m)^(q*k) at index (q-1)*m + k, for q in 1..P-1, k in 0..m-1
+    template <int P, bool inv>
+    static void apply(T *data, int n, int m, const T *twiddle, const T *cs, const T *sn)
+    {
+        for (int g = 0; g < n; g += P*m)
+            radix_butterflies_scalar<P, inv>(data + 2*g, m, 0, twiddle, cs, sn);
+    }
+};
+
+template <class T>
+struct FFTMixedRadix : impl::FFTBase<T>
+{
+    /// @param n    transform size
+    /// @param leaf power-of-two transform for the largest power of two dividing n
+    FFTMixedRadix(int n, std::shared_ptr<impl::FFTBase<T>> leaf) : n(n), leaf(std::move(leaf))
+    {
+        assert(is_mixed_radix_size(n));
+        leaf_size = n & -n;
+
+        int m = leaf_size;
+        int twiddle_size = 0;
+        for (int p : { 3, 5, 7 })
+        {
+            int rem = n / m;
+            while (rem % p == 0)
+            {
+                Stage s;
+                s.radix = p;
+                s.m = m;
+                s.twiddle_offset = twiddle_size;
+                twiddle_size += 2*(p-1)*m;
+                stages.push_back(s);
+                m *= p;
+                rem /= p;
+            }
+        }
+        assert(m == n);
+
+        twiddle = aligned_alloc_T<T>(twiddle_size, 32);
+        for (Stage &s : stages)
+        {
+            const int P = s.radix;
+            const int H = (P-1)/2;
+            const double L = (double)P * s.m;
+            T *w = twiddle + s.twiddle_offset;
+            for (int q = 1; q < P; q++)
+            {
+                for (int k = 0; k < s.m; k++, w += 2)
+                {
+                    double a = 2 * M_PI * ((double)q * k) / L;
+                    w[0] =  std::cos(a);
+                    w[1] = -std::sin(a);
+                }
+            }
+            for (int j = 1; j <= H; j++)
+            {
+                for (int k = 1; k <= H; k++)
+                {
+                    double a = 2 * M_PI * ((j * k) % P) / P;
+                    s.cs[(j-1)*H + k-1] = std::cos(a);
+                    s.sn[(j-1)*H + k-1] = std::sin(a);
+                }
+            }
+        }
+
+        // The leaf transforms expect bit-reversed order; each radix-p pass
+        // interleaves p such subsequences.
+        order.resize(n);
+        for (int i = 0; i < leaf_size; i++)
+        {
+            int r = 0;
+            for (int b = 1, rb = leaf_size >> 1; b < leaf_size; b <<= 1, rb >>= 1)
+                if (i & b)
+                    r |= rb;
+            order[i] = r;
+        }
+        m = leaf_size;
+        std::vector<int> tmp(n);
+        for (const Stage &s : stages)
+        {
+            for (int q = 0; q < s.radix; q++)
+                for (int t = 0; t < m; t++)
+                    tmp[q*m + t] = order[t]*s.radix + q;
+            m *= s.radix;
+            std::copy(tmp.begin(), tmp.begin() + m, order.begin());
+        }
+    }
+
+    ~FFTMixedRadix()
+    {
+        free(twiddle);
+    }
+
+    FFTMixedRadix(const FFTMixedRadix &) = delete;
+    FFTMixedRadix &operator=(const FFTMixedRadix &) = delete;
+
+    using impl::FFTBase<T>::forward;
+    using impl::FFTBase<T>::inverse;
+    void forward(T *data) override { transform_impl<false>(data); }
+    void inverse(T *data) override { transform_impl<true>(data); }
+    void forward_inplace(T *data) override { this->forward(data, copy_input(data)); }
+    void inverse_inplace(T *data) override { this->inverse(data, copy_input(data)); }
+
+    int size() const noexcept override { return n; }
+    const int *input_order() const noexcept override { return order.data(); }
+
+    static std::shared_ptr<impl::FFTBase<T>> GetInstance(int n, std::shared_ptr<impl::FFTBase<T>> leaf)
+    {
+        return impl::PlanRegistry<impl::FFTBase<T>>::instance().template get<FFTMixedRadix>(
+            n, n*sizeof(complex<T>), [&]() { return new FFTMixedRadix(n, std::move(leaf)); });
+    }
+
+private:
+    /// @brief Copies the data to per-thread scratch memory, so it can be reordered into the original array
+    const T *copy_input(const T *data)
+    {
+        T *copy = ThreadScratch<FFTMixedRadix>::template get<T>(2*(size_t)n);
+        std::copy(data, data + 2*(size_t)n, copy);
+        return copy;
+    }
+
+    template <bool inv>
+    void transform_impl(T *data)
+    {
+        if (leaf_size > 1)
+        {
+            for (int i = 0; i < n; i += leaf_size)
+                leaf->template transform<inv>(data + 2*i);
+        }
+        for (const Stage &s : stages)
+        {
+            const T *w = twiddle + s.twiddle_offset;
+            switch (s.radix)
+            {
+            case 3:
+                MixedRadixPass<T>::template apply<3, inv>(data, n, s.m, w, s.cs, s.sn);
+                break;
+            case 5:
+                MixedRadixPass<T>::template apply<5, inv>(data, n, s.m, w, s.cs, s.sn);
+                break;
+            case 7:
+                MixedRadixPass<T>::template apply<7, inv>(data, n, s.m, w, s.cs, s.sn);
+                break;
+            }
+        }
+    }
+
+    struct Stage
+    {
+        int radix, m;
+        ptrdiff_t twiddle_offset;
+        T cs[9], sn[9];
+    };
+
+    int n, leaf_size;
+    std::shared_ptr<impl::FFTBase<T>> leaf;
+    std::vector<Stage> stages;
+    std::vector<int> order;
+    T *twiddle = nullptr;
+};
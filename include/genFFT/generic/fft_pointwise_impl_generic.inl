@@ -0,0 +1,87 @@
+/*
+Copyright 2026 Michal Zientkiewicz
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Pointwise products of spectra, used by the fast convolution
+
+template <typename T>
+void pointwise_mul_impl(std::complex<T> *inout, const std::complex<T> *w, int n) noexcept
+{
+    T *x = (T *)inout;
+    const T *y = (const T *)w;
+#ifdef FFT_OPENMP_SIMD
+    #pragma omp simd
+#endif
+    for (int i = 0; i < 2*n; i += 2)
+    {
+        T re = x[i]*y[i]   - x[i+1]*y[i+1];
+        T im = x[i]*y[i+1] + x[i+1]*y[i];
+        x[i]   = re;
+        x[i+1] = im;
+    }
+}
+
+template <typename T>
+void pointwise_mul_add_impl(std::complex<T> *acc, const std::complex<T> *x, const std::complex<T> *w, int n) noexcept
+{
+    T *a = (T *)acc;
+    const T *p = (const T *)x;
+    const T *q = (const T *)w;
+#ifdef FFT_OPENMP_SIMD
+    #pragma omp simd
+#endif
+    for (int i = 0; i < 2*n; i += 2)
+    {
+        a[i]   += p[i]*q[i]   - p[i+1]*q[i+1];
+        a[i+1] += p[i]*q[i+1] + p[i+1]*q[i];
+    }
+}
+
+template <typename T>
+struct FFTPointwise : impl::FFTPointwiseBase<T>
+{
+    void multiply(T *inout, const T *w, int n) const noexcept override
+    {
+        pointwise_mul_impl((std::complex<T>*)inout, (const std::complex<T>*)w, n);
+    }
+
+    void multiply_add(T *acc, const T *x, const T *w, int n) const noexcept override
+    {
+        pointwise_mul_add_impl((std::complex<T>*)acc, (const std::complex<T>*)x, (const std::complex<T>*)w, n);
+    }
+
+    static std::shared_ptr<impl::FFTPointwiseBase<T>> GetInstance()
+    {
+        // stateless - a single instance serves all users
+        static std::shared_ptr<impl::FFTPointwiseBase<T>> instance = std::make_shared<FFTPointwise>();
+        return instance;
+    }
+};
+
+template <class T>
+inline std::shared_ptr<impl::FFTPointwiseBase<T>> GetPointwiseImpl(T)
+{
+    return FFTPointwise<T>::GetInstance();
+}
@@ -0,0 +1,198 @@
+/*
+Copyright 2026 Michal Zientkiewicz
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Stockham autosort FFT for power-of-two sizes
+//
+// Each pass reads one buffer and writes the other with unit-stride access;
+// the passes ping-pong between the output and a per-thread workspace
+// (ThreadScratch), so that neither bit reversal of the input nor a final copy
+// is needed.
+// Radix-4 passes are used, followed by one radix-2 pass for odd powers of two.
+
+/// @brief Computes Stockham butterflies for p in [p0, n/(2s)) - see StockhamPass::apply
+template <bool inv, typename T>
+inline void stockham_butterflies_scalar(T *y, const T *x, int n, int s, const T *twiddle, int p0)
+{
+    const int m = n / (2*s);
+    const T *x1 = x + 2*m*s;
+    for (int p = p0; p < m; p++)
+    {
+        T wr = twiddle[2*p*s];
+        T wi = twiddle[2*p*s+1];
+        const T *a = x + 2*p*s;
+        const T *b = x1 + 2*p*s;
+        T *y0 = y + 4*(ptrdiff_t)p*s;
+        T *y1 = y0 + 2*s;
+#ifdef FFT_OPENMP_SIMD
+        #pragma omp simd
+#endif
+        for (int q = 0; q < 2*s; q += 2)
+        {
+            T dr = a[q]   - b[q];
+            T di = a[q+1] - b[q+1];
+            y0[q]   = a[q]   + b[q];
+            y0[q+1] = a[q+1] + b[q+1];
+            y1[q]   = inv ? dr*wr + di*wi : dr*wr - di*wi;
+            y1[q+1] = inv ? di*wr - dr*wi : di*wr + dr*wi;
+        }
+    }
+}
+
+/// @brief Computes radix-4 Stockham butterflies for p in [p0, n/(4s)) - see StockhamPass::apply4
+template <bool inv, typename T>
+inline void stockham4_butterflies_scalar(T *y, const T *x, int n, int s,
+                                         const T *tw1, const T *tw2, const T *tw3, int p0)
+{
+    const int m = n / (4*s);
+    const std::complex<T> *X = (const std::complex<T> *)x;
+    std::complex<T> *Y = (std::complex<T> *)y;
+    for (int p = p0; p < m; p++)
+    {
+        std::complex<T> w1 = ((const std::complex<T> *)tw1)[p];
+        std::complex<T> w2 = ((const std::complex<T> *)tw2)[p];
+        std::complex<T> w3 = ((const std::complex<T> *)tw3)[p];
+        for (int q = 0; q < s; q++)
+        {
+            std::complex<T> a = X[q + s*p];
+            std::complex<T> b = X[q + s*(p + m)];
+            std::complex<T> c = X[q + s*(p + 2*m)];
+            std::complex<T> d = X[q + s*(p + 3*m)];
+            std::complex<T> apc = a + c, amc = a - c;
+            std::complex<T> bpd = b + d, bmd = rotate90<inv>(b - d);
+            Y[q + s*(4*p)]     = apc + bpd;
+            Y[q + s*(4*p + 1)] = complex_mul_scalar(amc + bmd, w1, inv);
+            Y[q + s*(4*p + 2)] = complex_mul_scalar(apc - bpd, w2, inv);
+            Y[q + s*(4*p + 3)] = complex_mul_scalar(amc - bmd, w3, inv);
+        }
+    }
+}
+
+template <typename T>
+struct StockhamPass
+{
+    /// @brief Computes one radix-2 Stockham pass
+    ///
+    /// The input is viewed as a [2][m][s] array and the output as [m][2][s], where m = n/(2s):
+    /// y[2p][q]   = x[0][p][q] + x[1][p][q]
+    /// y[2p+1][q] = (x[0][p][q] - x[1][p][q]) * W^(p*s)
+    ///
+    /// @param y        output, interleaved complex
+    /// @param x        input, interleaved complex
+    /// @param n        total transform size
+    /// @param s        length of the contiguous runs, in complex numbers
+    /// @param twiddle  W^k for k < n/2, interleaved complex
+    template <bool inv>
+    static void apply(T *y, const T *x, int n, int s, const T *twiddle)
+    {
+        stockham_butterflies_scalar<inv>(y, x, n, s, twiddle, 0);
+    }
+
+    /// @brief Computes one radix-4 Stockham pass
+    ///
+    /// The input is viewed as a [4][m][s] array and the output as [m][4][s], where m = n/(4s).
+    ///
+    /// @param w1, w2, w3  W^(ps), W^(2ps) and W^(3ps) for p < m, interleaved complex
+    template <bool inv>
+    static void apply4(T *y, const T *x, int n, int s, const T *w1, const T *w2, const T *w3)
+    {
+        stockham4_butterflies_scalar<inv>(y, x, n, s, w1, w2, w3, 0);
+    }
+};
+
+template <class T>
+struct FFTStockham : impl::FFTBase<T>
+{
+    explicit FFTStockham(int n) : n(n), twiddle(n)
+    {
+        assert(n >= 2 && (n & (n-1)) == 0);
+        int log2n = 0;
+        while ((1 << log2n) < n)
+            log2n++;
+        passes = log2n/2 + (log2n & 1);
+
+        // W^(ps), W^(2ps), W^(3ps) with W = exp(-2*pi*i/n) are the factors of an n/s-point radix-4 level
+        for (int s = 1; s <= n/4; s *= 4)
+            twiddle4.emplace_back(n / s);
+
+        order.resize(n);
+        for (int i = 0; i < n; i++)
+            order[i] = i;
+    }
+
+    FFTStockham(const FFTStockham &) = delete;
+    FFTStockham &operator=(const FFTStockham &) = delete;
+
+    void forward(T *data) override { transform_impl<false>(data, data); }
+    void inverse(T *data) override { transform_impl<true>(data, data); }
+    void forward(T *out, const T *in) override { transform_impl<false>(out, in); }
+    void inverse(T *out, const T *in) override { transform_impl<true>(out, in); }
+    // the input is in natural order already
+    void forward_inplace(T *data) override { transform_impl<false>(data, data); }
+    void inverse_inplace(T *data) override { transform_impl<true>(data, data); }
+
+    int size() const noexcept override { return n; }
+    const int *input_order() const noexcept override { return order.data(); }
+
+    static std::shared_ptr<impl::FFTBase<T>> GetInstance(int n)
+    {
+        return impl::PlanRegistry<impl::FFTBase<T>>::instance().template get<FFTStockham>(
+            n, n*sizeof(complex<T>), [n]() { return new FFTStockham(n); });
+    }
+
+private:
+    template <bool inv>
+    void transform_impl(T *out, const T *in)
+    {
+        T *work = ThreadScratch<FFTStockham>::template get<T>(2*(size_t)n);
+        // The passes alternate between out and work; the first destination
+        // is chosen so that the last pass writes to out.
+        T *dst = (passes & 1) ? out : work;
+        T *other = (passes & 1) ? work : out;
+        if (in == dst)
+        {
+            // in-place call with odd number of passes - the first pass can't overwrite its input
+            std::copy(in, in + 2*(size_t)n, work);
+            in = work;
+            other = work;
+        }
+        const T *src = in;
+        int s = 1;
+        for (const SharedTwiddle4<-1, T> &tw : twiddle4)
+        {
+            StockhamPass<T>::template apply4<inv>(dst, src, n, s, tw.w1(), tw.w2(), tw.w3());
+            s *= 4;
+            src = dst;
+            std::swap(dst, other);
+        }
+        if (s < n)
+            StockhamPass<T>::template apply<inv>(dst, src, n, s, twiddle.t);
+    }
+
+    int n, passes;
+    SharedTwiddle<-1, T> twiddle;
+    std::vector<SharedTwiddle4<-1, T>> twiddle4;
+    std::vector<int> order;
+};
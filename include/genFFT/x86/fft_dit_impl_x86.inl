@@ -48,6 +48,35 @@ inline void adjust_DIT_impl<float>(std::complex<float> *F, const std::complex<fl
     F[halfN] = Z[0];
     auto quarterval = conj(Z[halfN/2]);
     int i = 0, j = halfN;
+#ifdef GENFFT_USE_AVX512
+    const __m512i reverse = _mm512_set_epi64(0, 1, 2, 3, 4, 5, 6, 7);
+    for (; i < halfN/2; i+=8, j-=8)
+    {
+        // Z[i..i+7] and Z[j-7..j]; a partial last vector uses the low lanes of Ai
+        // and the high lanes of Bj, so the masked loads stay within the range
+        int count = halfN/2 - i < 8 ? halfN/2 - i : 8;
+        __mmask16 lo = first_lanes16(2*count);
+        __mmask16 hi = (__mmask16)(lo << (16 - 2*count));
+        __m512 Ai = _mm512_maskz_loadu_ps(lo, (const float *)&Z[i]);
+        __m512 Bj = flip_odd(_mm512_maskz_loadu_ps(hi, (const float *)&Z[j-7]));
+        __m512 Bi = _mm512_castpd_ps(_mm512_permutexvar_pd(reverse, _mm512_castps_pd(Bj)));
+        __m512 O = _mm512_mul_ps(_mm512_sub_ps(Ai, Bi), _mm512_set1_ps(0.5f));
+        __m512 T = _mm512_maskz_loadu_ps(lo, &twiddle[2*i]);
+        __m512 OxT = complex_mul<false>(O, T);
+        __m512 E = _mm512_add_ps(O, Bi);
+        __m512 Zi = _mm512_sub_ps(E, OxT);
+        __m512 Zj = flip_odd(_mm512_add_ps(E, OxT));
+        _mm512_mask_storeu_ps((float*)&F[i], lo, Zi);
+        Zj = _mm512_castpd_ps(_mm512_permutexvar_pd(reverse, _mm512_castps_pd(Zj)));
+        _mm512_mask_storeu_ps((float*)&F[j-7], hi, Zj);
+        if (count < 8)
+        {
+            i += count;
+            j -= count;
+            break;
+        }
+    }
+#endif
 #ifdef GENFFT_USE_AVX2
     __m256 halfmul8 = _mm256_set1_ps(0.5f);
     for (; i+4 <= halfN/2; i+=4, j-=4)
@@ -118,6 +147,86 @@ inline void adjust_DIT_impl<float>(std::complex<float> *F, const std::complex<fl
             F[i] = conj(F[N - i]);
 }
 
+template <>
+inline void adjust_DIT_inverse_impl<float>(std::complex<float> *Z, const std::complex<float> *F, int N, const float *twiddle) noexcept
+{
+    int halfN = N >> 1;
+    float zeroval = F[0].real();
+    float centerval = F[halfN].real();
+    auto quarterval = conj(F[halfN/2]) * 2.0f;
+    int i = 1, j = halfN-1;
+#ifdef GENFFT_USE_AVX512
+    const __m512i reverse = _mm512_set_epi64(0, 1, 2, 3, 4, 5, 6, 7);
+    for (; i < halfN/2; i+=8, j-=8)
+    {
+        // F[i..i+7] and F[j-7..j]; a partial last vector uses the low lanes of Fi
+        // and the high lanes of Fj, so the masked loads stay within the range
+        int count = halfN/2 - i < 8 ? halfN/2 - i : 8;
+        __mmask16 lo = first_lanes16(2*count);
+        __mmask16 hi = (__mmask16)(lo << (16 - 2*count));
+        __m512 Fi = _mm512_maskz_loadu_ps(lo, (const float *)&F[i]);
+        __m512 Fj = flip_odd(_mm512_maskz_loadu_ps(hi, (const float *)&F[j-7]));
+        __m512 Ci = _mm512_castpd_ps(_mm512_permutexvar_pd(reverse, _mm512_castps_pd(Fj)));
+        __m512 A = _mm512_add_ps(Fi, Ci);
+        __m512 B = _mm512_sub_ps(Fi, Ci);
+        __m512 BxT = complex_mul<true>(B, _mm512_maskz_loadu_ps(lo, &twiddle[2*i]));
+        __m512 Zi = _mm512_sub_ps(A, BxT);
+        __m512 Zj = flip_odd(_mm512_add_ps(A, BxT));
+        Zj = _mm512_castpd_ps(_mm512_permutexvar_pd(reverse, _mm512_castps_pd(Zj)));
+        _mm512_mask_storeu_ps((float*)&Z[i], lo, Zi);
+        _mm512_mask_storeu_ps((float*)&Z[j-7], hi, Zj);
+        if (count < 8)
+        {
+            i += count;
+            j -= count;
+            break;
+        }
+    }
+#endif
+#ifdef GENFFT_USE_AVX2
+    for (; i+4 <= halfN/2; i+=4, j-=4)
+    {
+        __m256 Fi = _mm256_loadu_ps((const float *)&F[i]);
+        __m256 Fj = flip_odd(_mm256_loadu_ps((const float *)&F[j-3]));
+        __m256 Ci = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(Fj), _MM_SHUFFLE(0, 1, 2, 3)));
+        __m256 A = _mm256_add_ps(Fi, Ci);
+        __m256 B = _mm256_sub_ps(Fi, Ci);
+        __m256 BxT = complex_mul<true>(B, _mm256_loadu_ps(&twiddle[2*i]));
+        __m256 Zi = _mm256_sub_ps(A, BxT);
+        __m256 Zj = flip_odd(_mm256_add_ps(A, BxT));
+        _mm256_storeu_ps((float*)&Z[i], Zi);
+        Zj = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(Zj), _MM_SHUFFLE(0, 1, 2, 3)));
+        _mm256_storeu_ps((float*)&Z[j-3], Zj);
+    }
+#endif
+#ifdef GENFFT_USE_SSE
+    for (; i+2 <= halfN/2; i+=2, j-=2)
+    {
+        __m128 Fi = _mm_loadu_ps((const float *)&F[i]);
+        __m128 Fj = flip_odd(_mm_loadu_ps((const float *)&F[j-1]));
+        __m128 Ci = _mm_shuffle_ps(Fj, Fj, _MM_SHUFFLE(1, 0, 3, 2));
+        __m128 A = _mm_add_ps(Fi, Ci);
+        __m128 B = _mm_sub_ps(Fi, Ci);
+        __m128 BxT = complex_mul<true>(B, _mm_loadu_ps(&twiddle[2*i]));
+        __m128 Zi = _mm_sub_ps(A, BxT);
+        __m128 Zj = flip_odd(_mm_add_ps(A, BxT));
+        _mm_storeu_ps((float*)&Z[i], Zi);
+        _mm_storeu_ps((float*)&Z[j-1], _mm_shuffle_ps(Zj, Zj, _MM_SHUFFLE(1, 0, 3, 2)));
+    }
+#endif
+    for (; i < halfN/2; i++, j--)
+    {
+        std::complex<float> A = F[i] + conj(F[j]);
+        std::complex<float> B = F[i] - conj(F[j]);
+        std::complex<float> ti = { twiddle[2*i], -twiddle[2*i+1] };
+        Z[i] = A - ti*B;
+        Z[j] = conj(A + ti*B);
+    }
+    Z[0] = { zeroval + centerval, zeroval - centerval };
+    if (halfN > 1)
+        Z[halfN/2] = quarterval;
+}
+
 template <>
 inline void adjust_DIT_impl<double>(std::complex<double> *F, const std::complex<double> *Z, int N, bool half, const double *twiddle) noexcept
 {
@@ -139,6 +248,50 @@ inline void adjust_DIT_impl<double>(std::complex<double> *F, const std::complex<
     F[halfN] = Z[0];
     auto quarterval = conj(Z[halfN/2]);
     int i = 0, j = halfN;
+#ifdef GENFFT_USE_AVX512
+    for (; i < halfN/2; i+=4, j-=4)
+    {
+        // Z[i..i+3] and Z[j-3..j]; a partial last vector uses the low lanes of Ai
+        // and the high lanes of Bj, so the masked loads stay within the range
+        int count = halfN/2 - i < 4 ? halfN/2 - i : 4;
+        __mmask8 lo = first_lanes8(2*count);
+        __mmask8 hi = (__mmask8)(lo << (8 - 2*count));
+        __m512d Ai = _mm512_maskz_loadu_pd(lo, (const double *)&Z[i]);
+        __m512d Bj = flip_odd(_mm512_maskz_loadu_pd(hi, (const double *)&Z[j-3]));
+        __m512d Bi = _mm512_shuffle_f64x2(Bj, Bj, _MM_SHUFFLE(0, 1, 2, 3));
+        __m512d O = _mm512_mul_pd(_mm512_sub_pd(Ai, Bi), _mm512_set1_pd(0.5));
+        __m512d T = _mm512_maskz_loadu_pd(lo, &twiddle[2*i]);
+        __m512d OxT = complex_mul<false>(O, T);
+        __m512d E = _mm512_add_pd(O, Bi);
+        __m512d Zi = _mm512_sub_pd(E, OxT);
+        __m512d Zj = flip_odd(_mm512_add_pd(E, OxT));
+        _mm512_mask_storeu_pd((double*)&F[i], lo, Zi);
+        Zj = _mm512_shuffle_f64x2(Zj, Zj, _MM_SHUFFLE(0, 1, 2, 3));
+        _mm512_mask_storeu_pd((double*)&F[j-3], hi, Zj);
+        if (count < 4)
+        {
+            i += count;
+            j -= count;
+            break;
+        }
+    }
+#endif
+#ifdef GENFFT_USE_AVX2
+    __m256d halfmul4 = _mm256_set1_pd(0.5);
+    for (; i+2 <= halfN/2; i+=2, j-=2)
+    {
+        __m256d Ai = _mm256_loadu_pd((const double *)&Z[i]);
+        __m256d Bj = flip_odd(_mm256_loadu_pd((const double *)&Z[j-1]));
+        __m256d Bi = _mm256_permute4x64_pd(Bj, _MM_SHUFFLE(1, 0, 3, 2));
+        __m256d O = _mm256_mul_pd(_mm256_sub_pd(Ai, Bi), halfmul4);
+        __m256d OxT = complex_mul<false>(O, _mm256_loadu_pd(&twiddle[2*i]));
+        __m256d E = _mm256_add_pd(O, Bi);
+        __m256d Zi = _mm256_sub_pd(E, OxT);
+        __m256d Zj = flip_odd(_mm256_add_pd(E, OxT));
+        _mm256_storeu_pd((double*)&F[i], Zi);
+        _mm256_storeu_pd((double*)&F[j-1], _mm256_permute4x64_pd(Zj, _MM_SHUFFLE(1, 0, 3, 2)));
+    }
+#endif
 #ifdef GENFFT_USE_SSE2
     __m128d halfmul2 = _mm_set1_pd(0.5);
     for (; i+1 <= halfN/2; i++, j--)
@@ -175,3 +328,78 @@ inline void adjust_DIT_impl<double>(std::complex<double> *F, const std::complex<
         for (int i = halfN+1; i < N; i++)
             F[i] = conj(F[N - i]);
 }
+
+template <>
+inline void adjust_DIT_inverse_impl<double>(std::complex<double> *Z, const std::complex<double> *F, int N, const double *twiddle) noexcept
+{
+    int halfN = N >> 1;
+    double zeroval = F[0].real();
+    double centerval = F[halfN].real();
+    auto quarterval = conj(F[halfN/2]) * 2.0;
+    int i = 1, j = halfN-1;
+#ifdef GENFFT_USE_AVX512
+    for (; i < halfN/2; i+=4, j-=4)
+    {
+        // F[i..i+3] and F[j-3..j]; a partial last vector uses the low lanes of Fi
+        // and the high lanes of Fj, so the masked loads stay within the range
+        int count = halfN/2 - i < 4 ? halfN/2 - i : 4;
+        __mmask8 lo = first_lanes8(2*count);
+        __mmask8 hi = (__mmask8)(lo << (8 - 2*count));
+        __m512d Fi = _mm512_maskz_loadu_pd(lo, (const double *)&F[i]);
+        __m512d Fj = flip_odd(_mm512_maskz_loadu_pd(hi, (const double *)&F[j-3]));
+        __m512d Ci = _mm512_shuffle_f64x2(Fj, Fj, _MM_SHUFFLE(0, 1, 2, 3));
+        __m512d A = _mm512_add_pd(Fi, Ci);
+        __m512d B = _mm512_sub_pd(Fi, Ci);
+        __m512d BxT = complex_mul<true>(B, _mm512_maskz_loadu_pd(lo, &twiddle[2*i]));
+        __m512d Zi = _mm512_sub_pd(A, BxT);
+        __m512d Zj = flip_odd(_mm512_add_pd(A, BxT));
+        Zj = _mm512_shuffle_f64x2(Zj, Zj, _MM_SHUFFLE(0, 1, 2, 3));
+        _mm512_mask_storeu_pd((double*)&Z[i], lo, Zi);
+        _mm512_mask_storeu_pd((double*)&Z[j-3], hi, Zj);
+        if (count < 4)
+        {
+            i += count;
+            j -= count;
+            break;
+        }
+    }
+#endif
+#ifdef GENFFT_USE_AVX2
+    for (; i+2 <= halfN/2; i+=2, j-=2)
+    {
+        __m256d Fi = _mm256_loadu_pd((const double *)&F[i]);
+        __m256d Fj = flip_odd(_mm256_loadu_pd((const double *)&F[j-1]));
+        __m256d Ci = _mm256_permute4x64_pd(Fj, _MM_SHUFFLE(1, 0, 3, 2));
+        __m256d A = _mm256_add_pd(Fi, Ci);
+        __m256d B = _mm256_sub_pd(Fi, Ci);
+        __m256d BxT = complex_mul<true>(B, _mm256_loadu_pd(&twiddle[2*i]));
+        __m256d Zi = _mm256_sub_pd(A, BxT);
+        __m256d Zj = flip_odd(_mm256_add_pd(A, BxT));
+        _mm256_storeu_pd((double*)&Z[i], Zi);
+        _mm256_storeu_pd((double*)&Z[j-1], _mm256_permute4x64_pd(Zj, _MM_SHUFFLE(1, 0, 3, 2)));
+    }
+#endif
+#ifdef GENFFT_USE_SSE2
+    for (; i < halfN/2; i++, j--)
+    {
+        __m128d Fi = _mm_loadu_pd((const double *)&F[i]);
+        __m128d Ci = flip_odd(_mm_loadu_pd((const double *)&F[j]));
+        __m128d A = _mm_add_pd(Fi, Ci);
+        __m128d B = _mm_sub_pd(Fi, Ci);
+        __m128d BxT = complex_mul<true>(B, _mm_loadu_pd(&twiddle[2*i]));
+        _mm_storeu_pd((double*)&Z[i], _mm_sub_pd(A, BxT));
+        _mm_storeu_pd((double*)&Z[j], flip_odd(_mm_add_pd(A, BxT)));
+    }
+#endif
+    for (; i < halfN/2; i++, j--)
+    {
+        std::complex<double> A = F[i] + conj(F[j]);
+        std::complex<double> B = F[i] - conj(F[j]);
+        std::complex<double> ti = { twiddle[2*i], -twiddle[2*i+1] };
+        Z[i] = A - ti*B;
+        Z[j] = conj(A + ti*B);
+    }
+    Z[0] = { zeroval + centerval, zeroval - centerval };
+    if (halfN > 1)
+        Z[halfN/2] = quarterval;
+}
@@ -28,7 +28,75 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 // Single row FFT for single precision doubleing point numbers
 
-template <int N>
+/// @brief Combines four consecutive transforms of size quarter into one of size 4*quarter
+/// @param w1 W^k, w2 W^2k, w3 W^3k for k < quarter, interleaved complex
+template <bool inv>
+inline void radix4_pass(double *data, int quarter, const double *w1, const double *w2, const double *w3)
+{
+    double *A = data;
+    double *B = A + 2*quarter;
+    double *C = B + 2*quarter;
+    double *D = C + 2*quarter;
+    int i = 0;
+#ifdef GENFFT_USE_AVX512
+    for (; i+8<=2*quarter; i+=8)
+    {
+        __m512d a = _mm512_loadu_pd(A+i);
+        __m512d b = _mm512_loadu_pd(B+i);
+        __m512d c = _mm512_loadu_pd(C+i);
+        __m512d d = _mm512_loadu_pd(D+i);
+        radix4_butterfly<inv>(a, b, c, d, _mm512_loadu_pd(w1+i), _mm512_loadu_pd(w2+i), _mm512_loadu_pd(w3+i));
+        _mm512_storeu_pd(A+i, a);
+        _mm512_storeu_pd(B+i, b);
+        _mm512_storeu_pd(C+i, c);
+        _mm512_storeu_pd(D+i, d);
+    }
+    if (i < 2*quarter)
+    {
+        __mmask8 m = first_lanes8(2*quarter - i);
+        __m512d a = _mm512_maskz_loadu_pd(m, A+i);
+        __m512d b = _mm512_maskz_loadu_pd(m, B+i);
+        __m512d c = _mm512_maskz_loadu_pd(m, C+i);
+        __m512d d = _mm512_maskz_loadu_pd(m, D+i);
+        radix4_butterfly<inv>(a, b, c, d,
+            _mm512_maskz_loadu_pd(m, w1+i), _mm512_maskz_loadu_pd(m, w2+i), _mm512_maskz_loadu_pd(m, w3+i));
+        _mm512_mask_storeu_pd(A+i, m, a);
+        _mm512_mask_storeu_pd(B+i, m, b);
+        _mm512_mask_storeu_pd(C+i, m, c);
+        _mm512_mask_storeu_pd(D+i, m, d);
+        i = 2*quarter;
+    }
+#elif defined GENFFT_USE_AVX
+    for (; i+4<=2*quarter; i+=4)
+    {
+        __m256d a = _mm256_loadu_pd(A+i);
+        __m256d b = _mm256_loadu_pd(B+i);
+        __m256d c = _mm256_loadu_pd(C+i);
+        __m256d d = _mm256_loadu_pd(D+i);
+        radix4_butterfly<inv>(a, b, c, d, _mm256_load_pd(w1+i), _mm256_load_pd(w2+i), _mm256_load_pd(w3+i));
+        _mm256_storeu_pd(A+i, a);
+        _mm256_storeu_pd(B+i, b);
+        _mm256_storeu_pd(C+i, c);
+        _mm256_storeu_pd(D+i, d);
+    }
+#endif
+    for (; i<2*quarter; i+=2)
+    {
+        __m128d a = _mm_loadu_pd(A+i);
+        __m128d b = _mm_loadu_pd(B+i);
+        __m128d c = _mm_loadu_pd(C+i);
+        __m128d d = _mm_loadu_pd(D+i);
+        radix4_butterfly<inv>(a, b, c, d, _mm_load_pd(w1+i), _mm_load_pd(w2+i), _mm_load_pd(w3+i));
+        _mm_storeu_pd(A+i, a);
+        _mm_storeu_pd(B+i, b);
+        _mm_storeu_pd(C+i, c);
+        _mm_storeu_pd(D+i, d);
+    }
+}
+
+// Levels of 16 points and more are computed with radix-4 passes,
+// which halves the number of passes over the data.
+template <int N, bool radix4 = (N >= 16)>
 struct FFTDouble
 {
     FFTDouble<N/2> next;
@@ -87,7 +155,24 @@ struct FFTDouble
 
     }
 
-    const Twiddle<N, double> twiddle;
+    const SharedTwiddle<N, double> twiddle;
+};
+
+template <int N>
+struct FFTDouble<N, true>
+{
+    FFTDouble<N/4> next;
+    template <bool inv>
+    void transform_impl(double *data)
+    {
+        next.template transform_impl<inv>(data);
+        next.template transform_impl<inv>(data+N/2);
+        next.template transform_impl<inv>(data+N);
+        next.template transform_impl<inv>(data+3*N/2);
+        radix4_pass<inv>(data, N/4, twiddle.w1(), twiddle.w2(), twiddle.w3());
+    }
+
+    const SharedTwiddle4<N, double> twiddle;
 };
 
 template <>
@@ -99,8 +184,19 @@ struct FFTDouble<2> : impl_generic::FFTGeneric<2, double> {};
 template <>
 struct FFTDouble<4>
 {
+#ifdef GENFFT_USE_AVX
     template <bool inv>
     void transform_impl(double *data)
+    {
+        __m256d lo, hi;
+        transform_regs<inv>(lo, hi, data);
+        _mm256_storeu_pd(data,     lo);
+        _mm256_storeu_pd(data + 4, hi);
+    }
+
+    /// @brief Computes the transform, leaving the result in registers
+    template <bool inv>
+    void transform_regs(__m256d &lo, __m256d &hi, const double *data)
     {
         __m128d x45 = _mm_loadu_pd(data+4);
         __m128d x67 = _mm_loadu_pd(data+6);
@@ -115,14 +211,30 @@ struct FFTDouble<4>
 
         __m128d y01 = _mm_add_pd(x01, x23);
         __m128d y23 = _mm_sub_pd(x01, x23);
-#ifdef GENFFT_USE_AVX
+
         __m256d y0123 = _mm256_insertf128_pd(_mm256_castpd128_pd256(y01), y23, 1);
         __m256d y4567 = _mm256_insertf128_pd(_mm256_castpd128_pd256(y45), y67, 1);
-        __m256d z0 = _mm256_add_pd(y0123, y4567);
-        _mm256_storeu_pd(data,     z0);
-        __m256d z1 = _mm256_sub_pd(y0123, y4567);
-        _mm256_storeu_pd(data + 4, z1);
+        lo = _mm256_add_pd(y0123, y4567);
+        hi = _mm256_sub_pd(y0123, y4567);
+    }
 #else
+    template <bool inv>
+    void transform_impl(double *data)
+    {
+        __m128d x45 = _mm_loadu_pd(data+4);
+        __m128d x67 = _mm_loadu_pd(data+6);
+
+        __m128d y45 = _mm_add_pd(x45, x67);
+
+        __m128d y76 = inv ? _mm_sub_pd(x67, x45) : _mm_sub_pd(x45, x67);
+        __m128d y67 = permute<_MM_SHUFFLE2(0,1)>(flip_even(y76));
+
+        __m128d x01 = _mm_loadu_pd(data);
+        __m128d x23 = _mm_loadu_pd(data+2);
+
+        __m128d y01 = _mm_add_pd(x01, x23);
+        __m128d y23 = _mm_sub_pd(x01, x23);
+
         __m128d z0 = _mm_add_pd(y01, y45);
         __m128d z1 = _mm_add_pd(y23, y67);
         __m128d z2 = _mm_sub_pd(y01, y45);
@@ -132,103 +244,218 @@ struct FFTDouble<4>
         _mm_storeu_pd(data+2, z1);
         _mm_storeu_pd(data+4, z2);
         _mm_storeu_pd(data+6, z3);
-#endif
     }
+#endif
 };
 
-// Vertical multi-column FFT for singgle precision doubleing point values
+#ifdef GENFFT_USE_AVX
+// Register-resident codelets: the whole transform is kept in N/2 YMM registers
+// and the data is loaded and stored only once.
 
 template <int N>
-struct FFTVertDouble
+struct FFTDoubleCodelet
 {
-    FFTVertDouble<N/2> next;
+    static constexpr int R = N/2;
+    FFTDoubleCodelet<N/4> next;
 
     template <bool inv>
-    void transform_impl(double *data, stride_t stride, index_t cols)
+    void transform_regs(__m256d *v, const double *data)
     {
-        const stride_t half = (N/2) * stride;
-        index_t next_col = cols;
-        // Process the input in vertical spans, 32 complex numbers wide.
-        // The last span may be wider, up to 48.
-        for (index_t col=0; col<cols; col=next_col)
+        next.template transform_regs<inv>(v,         data);
+        next.template transform_regs<inv>(v + R/4,   data + N/2);
+        next.template transform_regs<inv>(v + R/2,   data + N);
+        next.template transform_regs<inv>(v + 3*R/4, data + 3*N/2);
+        for (int i=0; i<R/4; i++)
+            butterfly<inv>(v, i);
+    }
+
+    template <bool inv>
+    void transform_impl(double *data)
+    {
+        __m256d v[R];
+        next.template transform_regs<inv>(v,         data);
+        next.template transform_regs<inv>(v + R/4,   data + N/2);
+        next.template transform_regs<inv>(v + R/2,   data + N);
+        next.template transform_regs<inv>(v + 3*R/4, data + 3*N/2);
+        // Store the results as soon as they're computed - storing the whole
+        // register array at the end is likely to be compiled as a block copy.
+        for (int i=0; i<R/4; i++)
         {
-            next_col = cols - col >= 48 ? col + 32 : cols;
-            index_t span_width = next_col - col;
-            double *span_data = data + 2*col;
-            transform_span<inv>(span_data, stride, span_width);
+            butterfly<inv>(v, i);
+            _mm256_storeu_pd(data + 4*i,           v[i]);
+            _mm256_storeu_pd(data + 4*(i + R/4),   v[i + R/4]);
+            _mm256_storeu_pd(data + 4*(i + R/2),   v[i + R/2]);
+            _mm256_storeu_pd(data + 4*(i + 3*R/4), v[i + 3*R/4]);
         }
     }
 
     template <bool inv>
-    void transform_span(double *data, stride_t stride, index_t cols)
+    void butterfly(__m256d *v, int i)
     {
-        stride_t half = (N/2) * stride;
-        next.template transform_impl<inv>(data,      stride, cols);
-        next.template transform_impl<inv>(data+half, stride, cols);
+        radix4_butterfly<inv>(v[i], v[i + R/4], v[i + R/2], v[i + 3*R/4],
+            _mm256_load_pd(twiddle.w1() + 4*i),
+            _mm256_load_pd(twiddle.w2() + 4*i),
+            _mm256_load_pd(twiddle.w3() + 4*i));
+    }
+
+    const SharedTwiddle4<N, double> twiddle;
+};
+
+template <>
+struct FFTDoubleCodelet<4>
+{
+    FFTDouble<4> leaf;
+    template <bool inv>
+    void transform_regs(__m256d *v, const double *data)
+    {
+        leaf.transform_regs<inv>(v[0], v[1], data);
+    }
+};
 
-        for (int i=0; i<N/2; i++)
+template <>
+struct FFTDoubleCodelet<8>
+{
+    FFTDoubleCodelet<4> next;
+    template <bool inv>
+    void transform_regs(__m256d *v, const double *data)
+    {
+        next.transform_regs<inv>(v,     data);
+        next.transform_regs<inv>(v + 2, data + 8);
+        for (int i=0; i<2; i++)
         {
-            double *even = data + i*stride;
-            double *odd  = even + half;
+            __m256d O = complex_mul<inv>(v[i + 2], _mm256_load_pd(twiddle.t + 4*i));
+            v[i + 2] = v[i] - O;
+            v[i]     = v[i] + O;
+        }
+    }
+
+    const SharedTwiddle<8, double> twiddle;
+};
 
-            index_t j=0;
+template <>
+struct FFTDouble<16> : FFTDoubleCodelet<16> {};
+
+template <>
+struct FFTDouble<32> : FFTDoubleCodelet<32> {};
+
+template <>
+struct FFTDouble<64> : FFTDoubleCodelet<64> {};
+#endif
+
+// Vertical multi-column FFT for singgle precision doubleing point values
+
+/// @brief Radix-2 butterflies between rows i and i + half_rows of a vertical FFT level
+template <bool inv>
+inline void vert_radix2_pass(double *data, stride_t stride, index_t cols, int half_rows, const double *twiddle)
+{
+    const stride_t half = half_rows * stride;
+    for (int i=0; i<half_rows; i++)
+    {
+        double *even = data + i*stride;
+        double *odd  = even + half;
+
+        index_t j=0;
+#ifdef GENFFT_USE_AVX512
+        __m512d W512 = _mm512_set4_pd(twiddle[2*i+1], twiddle[2*i], twiddle[2*i+1], twiddle[2*i]);
+
+        for (; j<2*cols; j+=8)
+        {
+            // the last, partial vector is processed with masked loads and stores
+            __mmask8 m = j+8<=2*cols ? (__mmask8)0xff : first_lanes8(2*cols - j);
+            __m512d E = _mm512_maskz_loadu_pd(m, even+j);
+            __m512d OxW = complex_mul<inv>(_mm512_maskz_loadu_pd(m, odd+j), W512);
+            _mm512_mask_storeu_pd(even+j, m, _mm512_add_pd(E, OxW));
+            _mm512_mask_storeu_pd(odd+j,  m, _mm512_sub_pd(E, OxW));
+        }
+#endif
 #ifdef GENFFT_USE_AVX
-            __m256d Wr = _mm256_broadcast_sd(&twiddle.t[2*i]);
-            __m256d Wi = _mm256_broadcast_sd(&twiddle.t[2*i+1]);
+        __m256d Wr = _mm256_broadcast_sd(&twiddle[2*i]);
+        __m256d Wi = _mm256_broadcast_sd(&twiddle[2*i+1]);
 
-            for (; j+4<=2*cols; j+=4)
-            {
-                __m256d E = _mm256_loadu_pd(even+j);
-                __m256d O = _mm256_loadu_pd(odd+j);
+        for (; j+4<=2*cols; j+=4)
+        {
+            __m256d E = _mm256_loadu_pd(even+j);
+            __m256d O = _mm256_loadu_pd(odd+j);
 
-                __m256d OxWi = _mm256_mul_pd(O, Wi);
-                __m256d OxWiperm = _mm256_permute_pd(OxWi, _MM_SHUFFLE4x2(0, 1, 0, 1));
+            __m256d OxWi = _mm256_mul_pd(O, Wi);
+            __m256d OxWiperm = _mm256_permute_pd(OxWi, _MM_SHUFFLE4x2(0, 1, 0, 1));
 #ifdef GENFFT_USE_FMA
-                __m256d OxW  = inv ? _mm256_fmsubadd_pd(O, Wr, OxWiperm)
-                                   : _mm256_fmaddsub_pd(O, Wr, OxWiperm);
+            __m256d OxW  = inv ? _mm256_fmsubadd_pd(O, Wr, OxWiperm)
+                               : _mm256_fmaddsub_pd(O, Wr, OxWiperm);
 #else
-                __m256d OxWr = _mm256_mul_pd(O, Wr);
-                __m256d OxW  = _mm256_addsub_pd(OxWr, inv ? -OxWiperm : OxWiperm);
+            __m256d OxWr = _mm256_mul_pd(O, Wr);
+            __m256d OxW  = _mm256_addsub_pd(OxWr, inv ? -OxWiperm : OxWiperm);
 #endif
-                __m256d lo = _mm256_add_pd(E, OxW);
-                __m256d hi = _mm256_sub_pd(E, OxW);
+            __m256d lo = _mm256_add_pd(E, OxW);
+            __m256d hi = _mm256_sub_pd(E, OxW);
 
-                _mm256_storeu_pd(even+j, lo);
-                _mm256_storeu_pd(odd+j,  hi);
-            }
+            _mm256_storeu_pd(even+j, lo);
+            _mm256_storeu_pd(odd+j,  hi);
+        }
 
-            __m128d Wr128 = _mm256_castpd256_pd128(Wr);
-            __m128d Wi128 = _mm256_castpd256_pd128(Wi);
+        __m128d Wr128 = _mm256_castpd256_pd128(Wr);
+        __m128d Wi128 = _mm256_castpd256_pd128(Wi);
 #else
-            __m128d Wr128 = _mm_set1_pd(twiddle[2*i]);
-            __m128d Wi128 = _mm_set1_pd(twiddle[2*i+1]);
+        __m128d Wr128 = _mm_set1_pd(twiddle[2*i]);
+        __m128d Wi128 = _mm_set1_pd(twiddle[2*i+1]);
 #endif
 
-            for (; j<2*cols; j+=2)
-            {
-                __m128d E = _mm_loadu_pd(even+j);
-                __m128d O = _mm_loadu_pd(odd+j);
+        for (; j<2*cols; j+=2)
+        {
+            __m128d E = _mm_loadu_pd(even+j);
+            __m128d O = _mm_loadu_pd(odd+j);
 
-                __m128d OxWi = _mm_mul_pd(O, Wi128);
-                __m128d Wxiperm = permute<_MM_SHUFFLE2(0, 1)>(OxWi);
+            __m128d OxWi = _mm_mul_pd(O, Wi128);
+            __m128d Wxiperm = permute<_MM_SHUFFLE2(0, 1)>(OxWi);
 #ifdef GENFFT_USE_FMA
-                __m128d OxW  = inv ? _mm_fmsubadd_pd(O, Wr128, Wxiperm)
-                                   : _mm_fmaddsub_pd(O, Wr128, Wxiperm);
+            __m128d OxW  = inv ? _mm_fmsubadd_pd(O, Wr128, Wxiperm)
+                               : _mm_fmaddsub_pd(O, Wr128, Wxiperm);
 #else
-                __m128d OxWr = _mm_mul_pd(O, Wr128);
-                __m128d OxW  = addsub(OxWr, inv ? -Wxiperm : Wxiperm);
+            __m128d OxWr = _mm_mul_pd(O, Wr128);
+            __m128d OxW  = addsub(OxWr, inv ? -Wxiperm : Wxiperm);
 #endif
-                __m128d lo = _mm_add_pd(E, OxW);
-                __m128d hi = _mm_sub_pd(E, OxW);
+            __m128d lo = _mm_add_pd(E, OxW);
+            __m128d hi = _mm_sub_pd(E, OxW);
 
-                _mm_storeu_pd(even+j, lo);
-                _mm_storeu_pd(odd+j,  hi);
-            }
+            _mm_storeu_pd(even+j, lo);
+            _mm_storeu_pd(odd+j,  hi);
         }
     }
+}
 
+template <int N>
+struct FFTVertDouble
+{
+    FFTVertDouble<N/2> next;
+
+    template <bool inv>
+    void transform_impl(double *data, stride_t stride, index_t cols)
+    {
+        const stride_t half = (N/2) * stride;
+        index_t next_col = cols;
+        // Process the input in vertical spans, 32 complex numbers wide.
+        // The last span may be wider, up to 48.
+        for (index_t col=0; col<cols; col=next_col)
+        {
+            next_col = cols - col >= 48 ? col + 32 : cols;
+            index_t span_width = next_col - col;
+            double *span_data = data + 2*col;
+            transform_span<inv>(span_data, stride, span_width);
+        }
+    }
+
+    template <bool inv>
+    void transform_span(double *data, stride_t stride, index_t cols)
+    {
+        stride_t half = (N/2) * stride;
+        next.template transform_impl<inv>(data,      stride, cols);
+        next.template transform_impl<inv>(data+half, stride, cols);
+
+        vert_radix2_pass<inv>(data, stride, cols, N/2, twiddle.t);
+    }
 
-    const Twiddle<N, double> twiddle;
+
+    const SharedTwiddle<N, double> twiddle;
 };
 
 
@@ -244,6 +471,26 @@ struct FFTVertDouble<4>
         double *row3 = row2+stride;
 
         index_t j = 0;
+#ifdef GENFFT_USE_AVX512
+        for (; j<cols*2; j+=8)
+        {
+            __mmask8 m = j+8<=cols*2 ? (__mmask8)0xff : first_lanes8(cols*2 - j);
+            __m512d x0 = _mm512_maskz_loadu_pd(m, row0+j);
+            __m512d x1 = _mm512_maskz_loadu_pd(m, row1+j);
+            __m512d x2 = _mm512_maskz_loadu_pd(m, row2+j);
+            __m512d x3 = _mm512_maskz_loadu_pd(m, row3+j);
+
+            __m512d y0 = _mm512_add_pd(x0, x1);
+            __m512d y1 = _mm512_sub_pd(x0, x1);
+            __m512d y2 = _mm512_add_pd(x2, x3);
+            __m512d y3 = rotate90<inv>(_mm512_sub_pd(x2, x3));
+
+            _mm512_mask_storeu_pd(row0+j, m, _mm512_add_pd(y0, y2));
+            _mm512_mask_storeu_pd(row1+j, m, _mm512_add_pd(y1, y3));
+            _mm512_mask_storeu_pd(row2+j, m, _mm512_sub_pd(y0, y2));
+            _mm512_mask_storeu_pd(row3+j, m, _mm512_sub_pd(y1, y3));
+        }
+#endif
 #ifdef GENFFT_USE_AVX
         for (; j+4<=cols*2; j+=4)
         {
@@ -317,6 +564,16 @@ struct FFTVertDouble<2>
         double *row1 = row0+stride;
 
         index_t j = 0;
+#ifdef GENFFT_USE_AVX512
+        for (; j<cols*2; j+=8)
+        {
+            __mmask8 m = j+8<=cols*2 ? (__mmask8)0xff : first_lanes8(cols*2 - j);
+            __m512d x0 = _mm512_maskz_loadu_pd(m, row0+j);
+            __m512d x1 = _mm512_maskz_loadu_pd(m, row1+j);
+            _mm512_mask_storeu_pd(row0+j, m, _mm512_add_pd(x0, x1));
+            _mm512_mask_storeu_pd(row1+j, m, _mm512_sub_pd(x0, x1));
+        }
+#endif
 #ifdef GENFFT_USE_AVX
         for (; j+4<=cols*2; j+=4)
         {
@@ -353,11 +610,122 @@ struct FFTVertDouble<1>
     void transform_impl(double *data, stride_t stride, index_t cols) {}
 };
 
+/// @brief Runtime-sized vertical FFT: radix-2 levels on top of a compile-time leaf transform
+template <>
+struct FFTVertDouble<-1>
+{
+    FFTVertDouble(int n, std::shared_ptr<impl::FFTVertBase<double>> leaf, int leaf_size) : N(n), leaf(std::move(leaf))
+    {
+        for (int size = leaf_size; size <= N/2; size *= 2)
+            twiddle.emplace_back(2*size);
+        assert(leaf_size << twiddle.size() == N);
+    }
+
+    template <bool inv>
+    void transform_impl(double *data, stride_t stride, index_t cols)
+    {
+        index_t next_col = cols;
+        // Process the input in vertical spans, 32 complex numbers wide.
+        // The last span may be wider, up to 48.
+        for (index_t col=0; col<cols; col=next_col)
+        {
+            next_col = cols - col >= 48 ? col + 32 : cols;
+            transform_span<inv>(data + 2*col, stride, next_col - col, (int)twiddle.size() - 1);
+        }
+    }
+
+    /// @brief Size of the leaf transform used for an n-point FFT
+    static int leaf_size(int n)
+    {
+        return n < (1<<GENFFT_MAX_STATIC_LOG2) ? n : (1<<GENFFT_MAX_STATIC_LOG2);
+    }
+
+private:
+    template <bool inv>
+    void transform_span(double *data, stride_t stride, index_t cols, int level)
+    {
+        if (level < 0)
+        {
+            leaf->template transform<inv>(data, stride, cols);
+            return;
+        }
+        const SharedTwiddle<-1, double> &tw = twiddle[level];
+        const int half_rows = tw.N/2;
+        transform_span<inv>(data,                    stride, cols, level-1);
+        transform_span<inv>(data + half_rows*stride, stride, cols, level-1);
+        vert_radix2_pass<inv>(data, stride, cols, half_rows, tw.t);
+    }
+
+    int N;
+    std::shared_ptr<impl::FFTVertBase<double>> leaf;
+    std::vector<SharedTwiddle<-1, double>> twiddle;
+};
+
+/// @brief Runtime-sized FFT: radix-4 levels on top of a compile-time leaf transform
+template <>
+struct FFTDouble<-1>
+{
+    FFTDouble(int n, std::shared_ptr<impl::FFTBase<double>> leaf) : N(n), leaf(std::move(leaf))
+    {
+        for (int size = this->leaf->size(); size <= N/4; size *= 4)
+            twiddle.emplace_back(4*size);
+        assert(this->leaf->size() << (2*twiddle.size()) == N);
+    }
+
+    template <bool inv>
+    void transform_impl(double *data)
+    {
+        transform_level<inv>(data, (int)twiddle.size() - 1);
+    }
+
+    int size() const noexcept { return N; }
+
+    /// @brief Size of the leaf transform used for an n-point FFT;
+    ///        n / leaf_size(n) is a power of 4
+    static int leaf_size(int n)
+    {
+        int leaf = n;
+        while (leaf > (1<<GENFFT_MAX_STATIC_LOG2))
+            leaf >>= 2;
+        return leaf;
+    }
+
+private:
+    template <bool inv>
+    void transform_level(double *data, int level)
+    {
+        if (level < 0)
+        {
+            leaf->template transform<inv>(data);
+            return;
+        }
+        const SharedTwiddle4<-1, double> &tw = twiddle[level];
+        const int quarter = tw.N/4;
+        for (int i = 0; i < 4; i++)
+            transform_level<inv>(data + 2*(ptrdiff_t)i*quarter, level-1);
+        radix4_pass<inv>(data, quarter, tw.w1(), tw.w2(), tw.w3());
+    }
+
+    int N;
+    std::shared_ptr<impl::FFTBase<double>> leaf;
+    std::vector<SharedTwiddle4<-1, double>> twiddle;
+};
+
+inline std::shared_ptr<impl::FFTVertBase<double>> GetVertImpl(int n, double);
+
+inline std::shared_ptr<impl::FFTDIFBase<double>> GetDIFImpl(int n, double);
+
 inline std::shared_ptr<impl::FFTBase<double>> GetImpl(int n, double)
 {
+    if (is_four_step_size(n))
+        return FFTFourStep<double>::GetInstance(n, GetImpl(four_step_cols(n), double()), GetVertImpl(n / four_step_cols(n), double()));
+
     switch (n)
     {
-#define SELECT_FFT_LEVEL(x) case (1<<x): return impl::FFTLevel<(1<<x), double, FFTDouble<(1<<x)>>::GetInstance();
+#define SELECT_FFT_LEVEL(x) case (1<<x): \
+            if (x <= GENFFT_MAX_STATIC_LOG2) \
+                return impl::FFTLevel<(1<<impl::static_log2(x)), double, FFTDouble<(1<<impl::static_log2(x))>>::GetInstance(); \
+            break;
             SELECT_FFT_LEVEL(0);
             SELECT_FFT_LEVEL(1);
             SELECT_FFT_LEVEL(2);
@@ -384,15 +752,219 @@ inline std::shared_ptr<impl::FFTBase<double>> GetImpl(int n, double)
             SELECT_FFT_LEVEL(23);
 #undef SELECT_FFT_LEVEL
         default:
-            assert(!"unsupported size");
+            break;
     }
+
+    if (is_mixed_radix_size(n))
+        return FFTMixedRadix<double>::GetInstance(n, GetImpl(n & -n, double()));
+    if (n > 0 && (n & (n-1)) == 0)
+        return impl::FFTLevel<-1, double, FFTDouble<-1>>::GetInstance(n, GetImpl(FFTDouble<-1>::leaf_size(n), double()));
+    if (is_bluestein_size(n))
+        return FFTBluestein<double>::GetInstance(n, GetImpl(bluestein_size(n), double()), GetDIFImpl(bluestein_size(n), double()));
+    assert(!"unsupported size");
+    return nullptr;
+}
+
+/// @brief Plan for naturally ordered data - the default one, there's no wisdom in native mode
+inline std::shared_ptr<impl::FFTBase<double>> GetTunedImpl(int n, double)
+{
+    return GetImpl(n, double());
+}
+
+inline std::shared_ptr<impl::FFTBase<double>> GetStockhamImpl(int n, double)
+{
+    if (n >= 2 && (n & (n-1)) == 0)
+        return FFTStockham<double>::GetInstance(n);
+    return GetImpl(n, double());
 }
 
+
 inline std::shared_ptr<impl::FFTVertBase<double>> GetVertImpl(int n, double)
 {
     switch (n)
     {
-#define SELECT_FFT_LEVEL(x) case (1<<x): return impl::FFTVertLevel<(1<<x), double, FFTVertDouble<(1<<x)>>::GetInstance();
+#define SELECT_FFT_LEVEL(x) case (1<<x): \
+            if (x <= GENFFT_MAX_STATIC_LOG2) \
+                return impl::FFTVertLevel<(1<<impl::static_log2(x)), double, FFTVertDouble<(1<<impl::static_log2(x))>>::GetInstance(); \
+            break;
+            SELECT_FFT_LEVEL(0);
+            SELECT_FFT_LEVEL(1);
+            SELECT_FFT_LEVEL(2);
+            SELECT_FFT_LEVEL(3);
+            SELECT_FFT_LEVEL(4);
+            SELECT_FFT_LEVEL(5);
+            SELECT_FFT_LEVEL(6);
+            SELECT_FFT_LEVEL(7);
+            SELECT_FFT_LEVEL(8);
+            SELECT_FFT_LEVEL(9);
+            SELECT_FFT_LEVEL(10);
+            SELECT_FFT_LEVEL(11);
+            SELECT_FFT_LEVEL(12);
+            SELECT_FFT_LEVEL(13);
+            SELECT_FFT_LEVEL(14);
+            SELECT_FFT_LEVEL(15);
+            SELECT_FFT_LEVEL(16);
+            SELECT_FFT_LEVEL(17);
+            SELECT_FFT_LEVEL(18);
+            SELECT_FFT_LEVEL(19);
+            SELECT_FFT_LEVEL(20);
+            SELECT_FFT_LEVEL(21);
+            SELECT_FFT_LEVEL(22);
+            SELECT_FFT_LEVEL(23);
+#undef SELECT_FFT_LEVEL
+        default:
+            break;
+    }
+
+    if (n > 0 && (n & (n-1)) == 0)
+    {
+        int leaf_size = FFTVertDouble<-1>::leaf_size(n);
+        return impl::FFTVertLevel<-1, double, FFTVertDouble<-1>>::GetInstance(n, GetVertImpl(leaf_size, double()), leaf_size);
+    }
+    assert(!"unsupported size");
+    return nullptr;
+}
+
+// Decimation-in-frequency FFT: natural order input, bit-reversed output
+
+/// @brief Splits a transform of size 4*quarter into four consecutive transforms of size quarter (DIF)
+/// @param w1 W^k, w2 W^2k, w3 W^3k for k < quarter, interleaved complex
+template <bool inv>
+inline void dif_radix4_pass(double *data, int quarter, const double *w1, const double *w2, const double *w3)
+{
+    double *A = data;
+    double *B = A + 2*quarter;
+    double *C = B + 2*quarter;
+    double *D = C + 2*quarter;
+    int i = 0;
+#ifdef GENFFT_USE_AVX512
+    for (; i+8<=2*quarter; i+=8)
+    {
+        __m512d a = _mm512_loadu_pd(A+i);
+        __m512d b = _mm512_loadu_pd(B+i);
+        __m512d c = _mm512_loadu_pd(C+i);
+        __m512d d = _mm512_loadu_pd(D+i);
+        radix4_dif_butterfly<inv>(a, b, c, d, _mm512_loadu_pd(w1+i), _mm512_loadu_pd(w2+i), _mm512_loadu_pd(w3+i));
+        _mm512_storeu_pd(A+i, a);
+        _mm512_storeu_pd(B+i, b);
+        _mm512_storeu_pd(C+i, c);
+        _mm512_storeu_pd(D+i, d);
+    }
+    if (i < 2*quarter)
+    {
+        __mmask8 m = first_lanes8(2*quarter - i);
+        __m512d a = _mm512_maskz_loadu_pd(m, A+i);
+        __m512d b = _mm512_maskz_loadu_pd(m, B+i);
+        __m512d c = _mm512_maskz_loadu_pd(m, C+i);
+        __m512d d = _mm512_maskz_loadu_pd(m, D+i);
+        radix4_dif_butterfly<inv>(a, b, c, d,
+            _mm512_maskz_loadu_pd(m, w1+i), _mm512_maskz_loadu_pd(m, w2+i), _mm512_maskz_loadu_pd(m, w3+i));
+        _mm512_mask_storeu_pd(A+i, m, a);
+        _mm512_mask_storeu_pd(B+i, m, b);
+        _mm512_mask_storeu_pd(C+i, m, c);
+        _mm512_mask_storeu_pd(D+i, m, d);
+        i = 2*quarter;
+    }
+#elif defined GENFFT_USE_AVX
+    for (; i+4<=2*quarter; i+=4)
+    {
+        __m256d a = _mm256_loadu_pd(A+i);
+        __m256d b = _mm256_loadu_pd(B+i);
+        __m256d c = _mm256_loadu_pd(C+i);
+        __m256d d = _mm256_loadu_pd(D+i);
+        radix4_dif_butterfly<inv>(a, b, c, d, _mm256_load_pd(w1+i), _mm256_load_pd(w2+i), _mm256_load_pd(w3+i));
+        _mm256_storeu_pd(A+i, a);
+        _mm256_storeu_pd(B+i, b);
+        _mm256_storeu_pd(C+i, c);
+        _mm256_storeu_pd(D+i, d);
+    }
+#endif
+    for (; i<2*quarter; i+=2)
+    {
+        __m128d a = _mm_loadu_pd(A+i);
+        __m128d b = _mm_loadu_pd(B+i);
+        __m128d c = _mm_loadu_pd(C+i);
+        __m128d d = _mm_loadu_pd(D+i);
+        radix4_dif_butterfly<inv>(a, b, c, d, _mm_load_pd(w1+i), _mm_load_pd(w2+i), _mm_load_pd(w3+i));
+        _mm_storeu_pd(A+i, a);
+        _mm_storeu_pd(B+i, b);
+        _mm_storeu_pd(C+i, c);
+        _mm_storeu_pd(D+i, d);
+    }
+}
+
+// DIF levels of 16 points and more are computed with radix-4 passes; smaller ones are generic
+template <int N, bool radix4 = (N >= 16)>
+struct FFTDIFDouble : impl_generic::FFTDIFGeneric<N, double> {};
+
+template <int N>
+struct FFTDIFDouble<N, true>
+{
+    FFTDIFDouble<N/4> next;
+    template <bool inv>
+    void transform_impl(double *data)
+    {
+        dif_radix4_pass<inv>(data, N/4, twiddle.w1(), twiddle.w2(), twiddle.w3());
+        next.template transform_impl<inv>(data);
+        next.template transform_impl<inv>(data+N/2);
+        next.template transform_impl<inv>(data+N);
+        next.template transform_impl<inv>(data+3*N/2);
+    }
+
+    const SharedTwiddle4<N, double> twiddle;
+};
+
+/// @brief Runtime-sized DIF FFT: radix-4 levels above a compile-time leaf transform
+template <>
+struct FFTDIFDouble<-1>
+{
+    FFTDIFDouble(int n, std::shared_ptr<impl::FFTDIFBase<double>> leaf) : N(n), leaf(std::move(leaf))
+    {
+        for (int size = this->leaf->size(); size <= N/4; size *= 4)
+            twiddle.emplace_back(4*size);
+        assert(this->leaf->size() << (2*twiddle.size()) == N);
+    }
+
+    template <bool inv>
+    void transform_impl(double *data)
+    {
+        transform_level<inv>(data, (int)twiddle.size() - 1);
+    }
+
+    int size() const noexcept { return N; }
+
+private:
+    template <bool inv>
+    void transform_level(double *data, int level)
+    {
+        if (level < 0)
+        {
+            leaf->template transform<inv>(data);
+            return;
+        }
+        const SharedTwiddle4<-1, double> &tw = twiddle[level];
+        const int quarter = tw.N/4;
+        dif_radix4_pass<inv>(data, quarter, tw.w1(), tw.w2(), tw.w3());
+        for (int i = 0; i < 4; i++)
+            transform_level<inv>(data + 2*(ptrdiff_t)i*quarter, level-1);
+    }
+
+    int N;
+    std::shared_ptr<impl::FFTDIFBase<double>> leaf;
+    std::vector<SharedTwiddle4<-1, double>> twiddle;
+};
+
+inline std::shared_ptr<impl::FFTDIFBase<double>> GetDIFImpl(int n, double)
+{
+    // DIF transforms support power-of-two sizes only
+    if (n <= 0 || (n & (n-1)) != 0)
+        return nullptr;
+    switch (n)
+    {
+#define SELECT_FFT_LEVEL(x) case (1<<x): \
+            if (x <= GENFFT_MAX_STATIC_LOG2) \
+                return impl::FFTDIFLevel<(1<<impl::static_log2(x)), double, FFTDIFDouble<(1<<impl::static_log2(x))>>::GetInstance(); \
+            break;
             SELECT_FFT_LEVEL(0);
             SELECT_FFT_LEVEL(1);
             SELECT_FFT_LEVEL(2);
@@ -419,6 +991,8 @@ inline std::shared_ptr<impl::FFTVertBase<double>> GetVertImpl(int n, double)
             SELECT_FFT_LEVEL(23);
 #undef SELECT_FFT_LEVEL
         default:
-            assert(!"unsupported size");
+            break;
     }
+    // same leaf as the DIT transform - n / leaf is a power of 4
+    return impl::FFTDIFLevel<-1, double, FFTDIFDouble<-1>>::GetInstance(n, GetDIFImpl(FFTDouble<-1>::leaf_size(n), double()));
 }
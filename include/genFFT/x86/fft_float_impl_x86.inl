@@ -28,7 +28,75 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 // Single row FFT for single precision floating point numbers
 
-template <int N>
+/// @brief Combines four consecutive transforms of size quarter into one of size 4*quarter
+/// @param w1 W^k, w2 W^2k, w3 W^3k for k < quarter, interleaved complex
+template <bool inv>
+inline void radix4_pass(float *data, int quarter, const float *w1, const float *w2, const float *w3)
+{
+    float *A = data;
+    float *B = A + 2*quarter;
+    float *C = B + 2*quarter;
+    float *D = C + 2*quarter;
+    int i = 0;
+#ifdef GENFFT_USE_AVX512
+    for (; i+16<=2*quarter; i+=16)
+    {
+        __m512 a = _mm512_loadu_ps(A+i);
+        __m512 b = _mm512_loadu_ps(B+i);
+        __m512 c = _mm512_loadu_ps(C+i);
+        __m512 d = _mm512_loadu_ps(D+i);
+        radix4_butterfly<inv>(a, b, c, d, _mm512_loadu_ps(w1+i), _mm512_loadu_ps(w2+i), _mm512_loadu_ps(w3+i));
+        _mm512_storeu_ps(A+i, a);
+        _mm512_storeu_ps(B+i, b);
+        _mm512_storeu_ps(C+i, c);
+        _mm512_storeu_ps(D+i, d);
+    }
+    if (i < 2*quarter)
+    {
+        __mmask16 m = first_lanes16(2*quarter - i);
+        __m512 a = _mm512_maskz_loadu_ps(m, A+i);
+        __m512 b = _mm512_maskz_loadu_ps(m, B+i);
+        __m512 c = _mm512_maskz_loadu_ps(m, C+i);
+        __m512 d = _mm512_maskz_loadu_ps(m, D+i);
+        radix4_butterfly<inv>(a, b, c, d,
+            _mm512_maskz_loadu_ps(m, w1+i), _mm512_maskz_loadu_ps(m, w2+i), _mm512_maskz_loadu_ps(m, w3+i));
+        _mm512_mask_storeu_ps(A+i, m, a);
+        _mm512_mask_storeu_ps(B+i, m, b);
+        _mm512_mask_storeu_ps(C+i, m, c);
+        _mm512_mask_storeu_ps(D+i, m, d);
+        i = 2*quarter;
+    }
+#elif defined GENFFT_USE_AVX
+    for (; i+8<=2*quarter; i+=8)
+    {
+        __m256 a = _mm256_loadu_ps(A+i);
+        __m256 b = _mm256_loadu_ps(B+i);
+        __m256 c = _mm256_loadu_ps(C+i);
+        __m256 d = _mm256_loadu_ps(D+i);
+        radix4_butterfly<inv>(a, b, c, d, _mm256_load_ps(w1+i), _mm256_load_ps(w2+i), _mm256_load_ps(w3+i));
+        _mm256_storeu_ps(A+i, a);
+        _mm256_storeu_ps(B+i, b);
+        _mm256_storeu_ps(C+i, c);
+        _mm256_storeu_ps(D+i, d);
+    }
+#endif
+    for (; i<2*quarter; i+=4)
+    {
+        __m128 a = _mm_loadu_ps(A+i);
+        __m128 b = _mm_loadu_ps(B+i);
+        __m128 c = _mm_loadu_ps(C+i);
+        __m128 d = _mm_loadu_ps(D+i);
+        radix4_butterfly<inv>(a, b, c, d, _mm_load_ps(w1+i), _mm_load_ps(w2+i), _mm_load_ps(w3+i));
+        _mm_storeu_ps(A+i, a);
+        _mm_storeu_ps(B+i, b);
+        _mm_storeu_ps(C+i, c);
+        _mm_storeu_ps(D+i, d);
+    }
+}
+
+// Levels of 16 points and more are computed with radix-4 passes,
+// which halves the number of passes over the data.
+template <int N, bool radix4 = (N >= 16)>
 struct FFTFloat
 {
     FFTFloat<N/2> next;
@@ -90,7 +158,24 @@ struct FFTFloat
 
     }
 
-    const Twiddle<N, float> twiddle;
+    const SharedTwiddle<N, float> twiddle;
+};
+
+template <int N>
+struct FFTFloat<N, true>
+{
+    FFTFloat<N/4> next;
+    template <bool inv>
+    void transform_impl(float *data)
+    {
+        next.template transform_impl<inv>(data);
+        next.template transform_impl<inv>(data+N/2);
+        next.template transform_impl<inv>(data+N);
+        next.template transform_impl<inv>(data+3*N/2);
+        radix4_pass<inv>(data, N/4, twiddle.w1(), twiddle.w2(), twiddle.w3());
+    }
+
+    const SharedTwiddle4<N, float> twiddle;
 };
 
 
@@ -104,7 +189,7 @@ template <>
 struct FFTFloat<4>
 {
     template <bool inv>
-    float8 transform_1x(float *data)
+    float8 transform_1x(const float *data)
     {
         __m128 xlo   = _mm_loadu_ps(data);
         __m128 xhi   = _mm_loadu_ps(data + 4);
@@ -133,7 +218,7 @@ struct FFTFloat<4>
 
 #ifdef GENFFT_USE_AVX
     template <bool inv>
-    void transform_2x(__m256 &E, __m256 &O, float *data)
+    void transform_2x(__m256 &E, __m256 &O, const float *data)
     {
         __m128 x0 = _mm_loadu_ps(data);
         __m128 x1 = _mm_loadu_ps(data+4);
@@ -184,6 +269,16 @@ struct FFTFloat<8>
 
     template <bool inv>
     void transform_impl(float *data)
+    {
+        __m256 lo, hi;
+        transform_regs<inv>(lo, hi, data);
+        store(data,     lo);
+        store(data + N, hi);
+    }
+
+    /// @brief Computes the transform, leaving the result in registers
+    template <bool inv>
+    void transform_regs(__m256 &lo, __m256 &hi, const float *data)
     {
 #ifdef GENFFT_USE_AVX
         float8 E, O;
@@ -212,12 +307,93 @@ struct FFTFloat<8>
         }
 
 
-        __m256 lo = _mm256_add_ps(E, OxW);
-        __m256 hi = _mm256_sub_ps(E, OxW);
-        store(data,     lo);
-        store(data + N, hi);
+        lo = _mm256_add_ps(E, OxW);
+        hi = _mm256_sub_ps(E, OxW);
+    }
+};
+
+// Register-resident codelets: the whole transform is kept in N/4 YMM registers
+// and the data is loaded and stored only once.
+
+template <int N>
+struct FFTFloatCodelet
+{
+    static constexpr int R = N/4;
+    FFTFloatCodelet<N/4> next;
+
+    template <bool inv>
+    void transform_regs(__m256 *v, const float *data)
+    {
+        next.template transform_regs<inv>(v,         data);
+        next.template transform_regs<inv>(v + R/4,   data + N/2);
+        next.template transform_regs<inv>(v + R/2,   data + N);
+        next.template transform_regs<inv>(v + 3*R/4, data + 3*N/2);
+        for (int i=0; i<R/4; i++)
+            butterfly<inv>(v, i);
+    }
+
+    template <bool inv>
+    void transform_impl(float *data)
+    {
+        __m256 v[R];
+        next.template transform_regs<inv>(v,         data);
+        next.template transform_regs<inv>(v + R/4,   data + N/2);
+        next.template transform_regs<inv>(v + R/2,   data + N);
+        next.template transform_regs<inv>(v + 3*R/4, data + 3*N/2);
+        // Store the results as soon as they're computed - storing the whole
+        // register array at the end is likely to be compiled as a block copy.
+        for (int i=0; i<R/4; i++)
+        {
+            butterfly<inv>(v, i);
+            _mm256_storeu_ps(data + 8*i,           v[i]);
+            _mm256_storeu_ps(data + 8*(i + R/4),   v[i + R/4]);
+            _mm256_storeu_ps(data + 8*(i + R/2),   v[i + R/2]);
+            _mm256_storeu_ps(data + 8*(i + 3*R/4), v[i + 3*R/4]);
+        }
     }
+
+    template <bool inv>
+    void butterfly(__m256 *v, int i)
+    {
+        radix4_butterfly<inv>(v[i], v[i + R/4], v[i + R/2], v[i + 3*R/4],
+            _mm256_load_ps(twiddle.w1() + 8*i),
+            _mm256_load_ps(twiddle.w2() + 8*i),
+            _mm256_load_ps(twiddle.w3() + 8*i));
+    }
+
+    const SharedTwiddle4<N, float> twiddle;
 };
+
+template <>
+struct FFTFloatCodelet<4>
+{
+    FFTFloat<4> leaf;
+    template <bool inv>
+    void transform_regs(__m256 *v, const float *data)
+    {
+        v[0] = leaf.transform_1x<inv>(data);
+    }
+};
+
+template <>
+struct FFTFloatCodelet<8>
+{
+    FFTFloat<8> leaf;
+    template <bool inv>
+    void transform_regs(__m256 *v, const float *data)
+    {
+        leaf.transform_regs<inv>(v[0], v[1], data);
+    }
+};
+
+template <>
+struct FFTFloat<16> : FFTFloatCodelet<16> {};
+
+template <>
+struct FFTFloat<32> : FFTFloatCodelet<32> {};
+
+template <>
+struct FFTFloat<64> : FFTFloatCodelet<64> {};
 #endif
 
 // Vertical multi-column FFT for single precision floating point values
@@ -232,6 +408,99 @@ inline index_t convenient_col_num(index_t cols, float)
 #endif
 }
 
+/// @brief Radix-2 butterflies between rows i and i + half_rows of a vertical FFT level
+template <bool inv>
+inline void vert_radix2_pass(float *data, stride_t stride, index_t cols, int half_rows, const float *twiddle)
+{
+    const stride_t half = half_rows * stride;
+    for (int i=0; i<half_rows; i++)
+    {
+        float *even = data + i*stride;
+        float *odd  = even + half;
+
+        index_t j=0;
+#ifdef GENFFT_USE_AVX512
+        __m512 Wr512 = _mm512_set1_ps(twiddle[2*i]);
+        __m512 Wi512 = _mm512_set1_ps(twiddle[2*i+1]);
+        __m512 W512 = _mm512_unpacklo_ps(Wr512, Wi512);
+
+        for (; j<2*cols; j+=16)
+        {
+            // the last, partial vector is processed with masked loads and stores
+            __mmask16 m = j+16<=2*cols ? (__mmask16)0xffff : first_lanes16(2*cols - j);
+            __m512 E = _mm512_maskz_loadu_ps(m, even+j);
+            __m512 OxW = complex_mul<inv>(_mm512_maskz_loadu_ps(m, odd+j), W512);
+            _mm512_mask_storeu_ps(even+j, m, _mm512_add_ps(E, OxW));
+            _mm512_mask_storeu_ps(odd+j,  m, _mm512_sub_ps(E, OxW));
+        }
+#endif
+#ifdef GENFFT_USE_AVX
+        __m256 Wr = _mm256_broadcast_ss(&twiddle[2*i]);
+        __m256 Wi = _mm256_broadcast_ss(&twiddle[2*i+1]);
+
+        for (; j+8<=2*cols; j+=8)
+        {
+            __m256 E = _mm256_loadu_ps(even+j);
+            __m256 O = _mm256_loadu_ps(odd+j);
+
+            __m256 OxWi = _mm256_mul_ps(O, Wi);
+            __m256 OxWiperm = _mm256_permute_ps(OxWi, _MM_SHUFFLE(2, 3, 0, 1));
+#ifdef GENFFT_USE_FMA
+            __m256 OxW  = inv ? _mm256_fmsubadd_ps(O, Wr, OxWiperm)
+                              : _mm256_fmaddsub_ps(O, Wr, OxWiperm);
+#else
+            __m256 OxWr = _mm256_mul_ps(O, Wr);
+            __m256 OxW  = _mm256_addsub_ps(OxWr, inv ? -OxWiperm : OxWiperm);
+#endif
+            __m256 lo = _mm256_add_ps(E, OxW);
+            __m256 hi = _mm256_sub_ps(E, OxW);
+
+            _mm256_storeu_ps(even+j, lo);
+            _mm256_storeu_ps(odd+j,  hi);
+        }
+
+        __m128 Wr128 = _mm256_castps256_ps128(Wr);
+        __m128 Wi128 = _mm256_castps256_ps128(Wi);
+#else
+        __m128 Wr128 = _mm_set1_ps(twiddle[2*i]);
+        __m128 Wi128 = _mm_set1_ps(twiddle[2*i+1]);
+#endif
+
+        for (; j+4<=2*cols; j+=4)
+        {
+            __m128 E = _mm_loadu_ps(even+j);
+            __m128 O = _mm_loadu_ps(odd+j);
+
+            __m128 OxWi = _mm_mul_ps(O, Wi128);
+            __m128 Wxiperm = permute<_MM_SHUFFLE(2, 3, 0, 1)>(OxWi);
+#ifdef GENFFT_USE_FMA
+            __m128 OxW  = inv ? _mm_fmsubadd_ps(O, Wr128, Wxiperm)
+                              : _mm_fmaddsub_ps(O, Wr128, Wxiperm);
+#else
+            __m128 OxWr = _mm_mul_ps(O, Wr128);
+            __m128 OxW  = inv ? subadd(OxWr, Wxiperm) : addsub(OxWr, Wxiperm);
+#endif
+            __m128 lo = _mm_add_ps(E, OxW);
+            __m128 hi = _mm_sub_ps(E, OxW);
+
+            _mm_storeu_ps(even+j, lo);
+            _mm_storeu_ps(odd+j,  hi);
+        }
+
+        float wr = twiddle[2*i];
+        float wi = twiddle[2*i+1];
+        for (; j<2*cols; j+=2)
+        {
+            float tempr = inv ? odd[j]*wr + odd[j+1]*wi : odd[j]*wr - odd[j+1]*wi;
+            float tempi = inv ? odd[j+1]*wr -odd[j]*wi : odd[j]*wi + odd[j+1]*wr;
+            odd[j]    = even[j]-tempr;
+            odd[j+1]  = even[j+1]-tempi;
+            even[j]   += tempr;
+            even[j+1] += tempi;
+        }
+    }
+}
+
 template <int N>
 struct FFTVertFloat
 {
@@ -260,80 +529,10 @@ struct FFTVertFloat
         next.template transform_impl<inv>(data,      stride, cols);
         next.template transform_impl<inv>(data+half, stride, cols);
 
-        for (int i=0; i<N/2; i++)
-        {
-            float *even = data + i*stride;
-            float *odd  = even + half;
-
-            index_t j=0;
-#ifdef GENFFT_USE_AVX
-            __m256 Wr = _mm256_broadcast_ss(&twiddle.t[2*i]);
-            __m256 Wi = _mm256_broadcast_ss(&twiddle.t[2*i+1]);
-
-            for (; j+8<=2*cols; j+=8)
-            {
-                __m256 E = _mm256_loadu_ps(even+j);
-                __m256 O = _mm256_loadu_ps(odd+j);
-
-                __m256 OxWi = _mm256_mul_ps(O, Wi);
-                __m256 OxWiperm = _mm256_permute_ps(OxWi, _MM_SHUFFLE(2, 3, 0, 1));
-#ifdef GENFFT_USE_FMA
-                __m256 OxW  = inv ? _mm256_fmsubadd_ps(O, Wr, OxWiperm)
-                                  : _mm256_fmaddsub_ps(O, Wr, OxWiperm);
-#else
-                __m256 OxWr = _mm256_mul_ps(O, Wr);
-                __m256 OxW  = _mm256_addsub_ps(OxWr, inv ? -OxWiperm : OxWiperm);
-#endif
-                __m256 lo = _mm256_add_ps(E, OxW);
-                __m256 hi = _mm256_sub_ps(E, OxW);
-
-                _mm256_storeu_ps(even+j, lo);
-                _mm256_storeu_ps(odd+j,  hi);
-            }
-
-            __m128 Wr128 = _mm256_castps256_ps128(Wr);
-            __m128 Wi128 = _mm256_castps256_ps128(Wi);
-#else
-            __m128 Wr128 = _mm_set1_ps(twiddle[2*i]);
-            __m128 Wi128 = _mm_set1_ps(twiddle[2*i+1]);
-#endif
-
-            for (; j+4<=2*cols; j+=4)
-            {
-                __m128 E = _mm_loadu_ps(even+j);
-                __m128 O = _mm_loadu_ps(odd+j);
-
-                __m128 OxWi = _mm_mul_ps(O, Wi128);
-                __m128 Wxiperm = permute<_MM_SHUFFLE(2, 3, 0, 1)>(OxWi);
-#ifdef GENFFT_USE_FMA
-                __m128 OxW  = inv ? _mm_fmsubadd_ps(O, Wr128, Wxiperm)
-                                  : _mm_fmaddsub_ps(O, Wr128, Wxiperm);
-#else
-                __m128 OxWr = _mm_mul_ps(O, Wr128);
-                __m128 OxW  = inv ? subadd(OxWr, Wxiperm) : addsub(OxWr, Wxiperm);
-#endif
-                __m128 lo = _mm_add_ps(E, OxW);
-                __m128 hi = _mm_sub_ps(E, OxW);
-
-                _mm_storeu_ps(even+j, lo);
-                _mm_storeu_ps(odd+j,  hi);
-            }
-
-            float wr = twiddle[2*i];
-            float wi = twiddle[2*i+1];
-            for (; j<2*cols; j+=2)
-            {
-                float tempr = inv ? odd[j]*wr + odd[j+1]*wi : odd[j]*wr - odd[j+1]*wi;
-                float tempi = inv ? odd[j+1]*wr -odd[j]*wi : odd[j]*wi + odd[j+1]*wr;
-                odd[j]    = even[j]-tempr;
-                odd[j+1]  = even[j+1]-tempi;
-                even[j]   += tempr;
-                even[j+1] += tempi;
-            }
-        }
+        vert_radix2_pass<inv>(data, stride, cols, N/2, twiddle.t);
     }
 
-    const Twiddle<N, float> twiddle;
+    const SharedTwiddle<N, float> twiddle;
 };
 
 
@@ -349,6 +548,26 @@ struct FFTVertFloat<4>
         float *row3 = row2+stride;
 
         index_t j = 0;
+#ifdef GENFFT_USE_AVX512
+        for (; j<cols*2; j+=16)
+        {
+            __mmask16 m = j+16<=cols*2 ? (__mmask16)0xffff : first_lanes16(cols*2 - j);
+            __m512 x0 = _mm512_maskz_loadu_ps(m, row0+j);
+            __m512 x1 = _mm512_maskz_loadu_ps(m, row1+j);
+            __m512 x2 = _mm512_maskz_loadu_ps(m, row2+j);
+            __m512 x3 = _mm512_maskz_loadu_ps(m, row3+j);
+
+            __m512 y0 = _mm512_add_ps(x0, x1);
+            __m512 y1 = _mm512_sub_ps(x0, x1);
+            __m512 y2 = _mm512_add_ps(x2, x3);
+            __m512 y3 = rotate90<inv>(_mm512_sub_ps(x2, x3));
+
+            _mm512_mask_storeu_ps(row0+j, m, _mm512_add_ps(y0, y2));
+            _mm512_mask_storeu_ps(row1+j, m, _mm512_add_ps(y1, y3));
+            _mm512_mask_storeu_ps(row2+j, m, _mm512_sub_ps(y0, y2));
+            _mm512_mask_storeu_ps(row3+j, m, _mm512_sub_ps(y1, y3));
+        }
+#endif
 #ifdef GENFFT_USE_AVX
         for (; j+8<=cols*2; j+=8)
         {
@@ -433,6 +652,16 @@ struct FFTVertFloat<2>
         float *row1 = row0+stride;
 
         index_t j = 0;
+#ifdef GENFFT_USE_AVX512
+        for (; j<cols*2; j+=16)
+        {
+            __mmask16 m = j+16<=cols*2 ? (__mmask16)0xffff : first_lanes16(cols*2 - j);
+            __m512 x0 = _mm512_maskz_loadu_ps(m, row0+j);
+            __m512 x1 = _mm512_maskz_loadu_ps(m, row1+j);
+            _mm512_mask_storeu_ps(row0+j, m, _mm512_add_ps(x0, x1));
+            _mm512_mask_storeu_ps(row1+j, m, _mm512_sub_ps(x0, x1));
+        }
+#endif
 #ifdef GENFFT_USE_AVX
         for (; j+8<=cols*2; j+=8)
         {
@@ -461,11 +690,122 @@ struct FFTVertFloat<2>
     }
 };
 
+/// @brief Runtime-sized vertical FFT: radix-2 levels on top of a compile-time leaf transform
+template <>
+struct FFTVertFloat<-1>
+{
+    FFTVertFloat(int n, std::shared_ptr<impl::FFTVertBase<float>> leaf, int leaf_size) : N(n), leaf(std::move(leaf))
+    {
+        for (int size = leaf_size; size <= N/2; size *= 2)
+            twiddle.emplace_back(2*size);
+        assert(leaf_size << twiddle.size() == N);
+    }
+
+    template <bool inv>
+    void transform_impl(float *data, stride_t stride, index_t cols)
+    {
+        index_t next_col = cols;
+        // Process the input in vertical spans, 32 complex numbers wide.
+        // The last span may be wider, up to 48.
+        for (index_t col=0; col<cols; col=next_col)
+        {
+            next_col = cols - col >= 48 ? col + 32 : cols;
+            transform_span<inv>(data + 2*col, stride, next_col - col, (int)twiddle.size() - 1);
+        }
+    }
+
+    /// @brief Size of the leaf transform used for an n-point FFT
+    static int leaf_size(int n)
+    {
+        return n < (1<<GENFFT_MAX_STATIC_LOG2) ? n : (1<<GENFFT_MAX_STATIC_LOG2);
+    }
+
+private:
+    template <bool inv>
+    void transform_span(float *data, stride_t stride, index_t cols, int level)
+    {
+        if (level < 0)
+        {
+            leaf->template transform<inv>(data, stride, cols);
+            return;
+        }
+        const SharedTwiddle<-1, float> &tw = twiddle[level];
+        const int half_rows = tw.N/2;
+        transform_span<inv>(data,                    stride, cols, level-1);
+        transform_span<inv>(data + half_rows*stride, stride, cols, level-1);
+        vert_radix2_pass<inv>(data, stride, cols, half_rows, tw.t);
+    }
+
+    int N;
+    std::shared_ptr<impl::FFTVertBase<float>> leaf;
+    std::vector<SharedTwiddle<-1, float>> twiddle;
+};
+
+/// @brief Runtime-sized FFT: radix-4 levels on top of a compile-time leaf transform
+template <>
+struct FFTFloat<-1>
+{
+    FFTFloat(int n, std::shared_ptr<impl::FFTBase<float>> leaf) : N(n), leaf(std::move(leaf))
+    {
+        for (int size = this->leaf->size(); size <= N/4; size *= 4)
+            twiddle.emplace_back(4*size);
+        assert(this->leaf->size() << (2*twiddle.size()) == N);
+    }
+
+    template <bool inv>
+    void transform_impl(float *data)
+    {
+        transform_level<inv>(data, (int)twiddle.size() - 1);
+    }
+
+    int size() const noexcept { return N; }
+
+    /// @brief Size of the leaf transform used for an n-point FFT;
+    ///        n / leaf_size(n) is a power of 4
+    static int leaf_size(int n)
+    {
+        int leaf = n;
+        while (leaf > (1<<GENFFT_MAX_STATIC_LOG2))
+            leaf >>= 2;
+        return leaf;
+    }
+
+private:
+    template <bool inv>
+    void transform_level(float *data, int level)
+    {
+        if (level < 0)
+        {
+            leaf->template transform<inv>(data);
+            return;
+        }
+        const SharedTwiddle4<-1, float> &tw = twiddle[level];
+        const int quarter = tw.N/4;
+        for (int i = 0; i < 4; i++)
+            transform_level<inv>(data + 2*(ptrdiff_t)i*quarter, level-1);
+        radix4_pass<inv>(data, quarter, tw.w1(), tw.w2(), tw.w3());
+    }
+
+    int N;
+    std::shared_ptr<impl::FFTBase<float>> leaf;
+    std::vector<SharedTwiddle4<-1, float>> twiddle;
+};
+
+inline std::shared_ptr<impl::FFTVertBase<float>> GetVertImpl(int n, float);
+
+inline std::shared_ptr<impl::FFTDIFBase<float>> GetDIFImpl(int n, float);
+
 inline std::shared_ptr<impl::FFTBase<float>> GetImpl(int n, float)
 {
+    if (is_four_step_size(n))
+        return FFTFourStep<float>::GetInstance(n, GetImpl(four_step_cols(n), float()), GetVertImpl(n / four_step_cols(n), float()));
+
     switch (n)
     {
-#define SELECT_FFT_LEVEL(x) case (1<<x): return impl::FFTLevel<(1<<x), float, FFTFloat<(1<<x)>>::GetInstance();
+#define SELECT_FFT_LEVEL(x) case (1<<x): \
+            if (x <= GENFFT_MAX_STATIC_LOG2) \
+                return impl::FFTLevel<(1<<impl::static_log2(x)), float, FFTFloat<(1<<impl::static_log2(x))>>::GetInstance(); \
+            break;
             SELECT_FFT_LEVEL(0);
             SELECT_FFT_LEVEL(1);
             SELECT_FFT_LEVEL(2);
@@ -492,8 +832,31 @@ inline std::shared_ptr<impl::FFTBase<float>> GetImpl(int n, float)
             SELECT_FFT_LEVEL(23);
 #undef SELECT_FFT_LEVEL
         default:
-            assert(!"unsupported size");
+            break;
     }
+
+    if (is_mixed_radix_size(n))
+        return FFTMixedRadix<float>::GetInstance(n, GetImpl(n & -n, float()));
+    if (n > 0 && (n & (n-1)) == 0)
+        return impl::FFTLevel<-1, float, FFTFloat<-1>>::GetInstance(n, GetImpl(FFTFloat<-1>::leaf_size(n), float()));
+    if (is_bluestein_size(n))
+        return FFTBluestein<float>::GetInstance(n, GetImpl(bluestein_size(n), float()), GetDIFImpl(bluestein_size(n), float()));
+    assert(!"unsupported size");
+    return nullptr;
+}
+
+
+/// @brief Plan for naturally ordered data - the default one, there's no wisdom in native mode
+inline std::shared_ptr<impl::FFTBase<float>> GetTunedImpl(int n, float)
+{
+    return GetImpl(n, float());
+}
+
+inline std::shared_ptr<impl::FFTBase<float>> GetStockhamImpl(int n, float)
+{
+    if (n >= 2 && (n & (n-1)) == 0)
+        return FFTStockham<float>::GetInstance(n);
+    return GetImpl(n, float());
 }
 
 
@@ -501,7 +864,188 @@ inline std::shared_ptr<impl::FFTVertBase<float>> GetVertImpl(int n, float)
 {
     switch (n)
     {
-#define SELECT_FFT_LEVEL(x) case (1<<x): return impl::FFTVertLevel<(1<<x), float, FFTVertFloat<(1<<x)>>::GetInstance();
+#define SELECT_FFT_LEVEL(x) case (1<<x): \
+            if (x <= GENFFT_MAX_STATIC_LOG2) \
+                return impl::FFTVertLevel<(1<<impl::static_log2(x)), float, FFTVertFloat<(1<<impl::static_log2(x))>>::GetInstance(); \
+            break;
+            SELECT_FFT_LEVEL(0);
+            SELECT_FFT_LEVEL(1);
+            SELECT_FFT_LEVEL(2);
+            SELECT_FFT_LEVEL(3);
+            SELECT_FFT_LEVEL(4);
+            SELECT_FFT_LEVEL(5);
+            SELECT_FFT_LEVEL(6);
+            SELECT_FFT_LEVEL(7);
+            SELECT_FFT_LEVEL(8);
+            SELECT_FFT_LEVEL(9);
+            SELECT_FFT_LEVEL(10);
+            SELECT_FFT_LEVEL(11);
+            SELECT_FFT_LEVEL(12);
+            SELECT_FFT_LEVEL(13);
+            SELECT_FFT_LEVEL(14);
+            SELECT_FFT_LEVEL(15);
+            SELECT_FFT_LEVEL(16);
+            SELECT_FFT_LEVEL(17);
+            SELECT_FFT_LEVEL(18);
+            SELECT_FFT_LEVEL(19);
+            SELECT_FFT_LEVEL(20);
+            SELECT_FFT_LEVEL(21);
+            SELECT_FFT_LEVEL(22);
+            SELECT_FFT_LEVEL(23);
+#undef SELECT_FFT_LEVEL
+        default:
+            break;
+    }
+
+    if (n > 0 && (n & (n-1)) == 0)
+    {
+        int leaf_size = FFTVertFloat<-1>::leaf_size(n);
+        return impl::FFTVertLevel<-1, float, FFTVertFloat<-1>>::GetInstance(n, GetVertImpl(leaf_size, float()), leaf_size);
+    }
+    assert(!"unsupported size");
+    return nullptr;
+}
+
+// Decimation-in-frequency FFT: natural order input, bit-reversed output
+
+/// @brief Splits a transform of size 4*quarter into four consecutive transforms of size quarter (DIF)
+/// @param w1 W^k, w2 W^2k, w3 W^3k for k < quarter, interleaved complex
+template <bool inv>
+inline void dif_radix4_pass(float *data, int quarter, const float *w1, const float *w2, const float *w3)
+{
+    float *A = data;
+    float *B = A + 2*quarter;
+    float *C = B + 2*quarter;
+    float *D = C + 2*quarter;
+    int i = 0;
+#ifdef GENFFT_USE_AVX512
+    for (; i+16<=2*quarter; i+=16)
+    {
+        __m512 a = _mm512_loadu_ps(A+i);
+        __m512 b = _mm512_loadu_ps(B+i);
+        __m512 c = _mm512_loadu_ps(C+i);
+        __m512 d = _mm512_loadu_ps(D+i);
+        radix4_dif_butterfly<inv>(a, b, c, d, _mm512_loadu_ps(w1+i), _mm512_loadu_ps(w2+i), _mm512_loadu_ps(w3+i));
+        _mm512_storeu_ps(A+i, a);
+        _mm512_storeu_ps(B+i, b);
+        _mm512_storeu_ps(C+i, c);
+        _mm512_storeu_ps(D+i, d);
+    }
+    if (i < 2*quarter)
+    {
+        __mmask16 m = first_lanes16(2*quarter - i);
+        __m512 a = _mm512_maskz_loadu_ps(m, A+i);
+        __m512 b = _mm512_maskz_loadu_ps(m, B+i);
+        __m512 c = _mm512_maskz_loadu_ps(m, C+i);
+        __m512 d = _mm512_maskz_loadu_ps(m, D+i);
+        radix4_dif_butterfly<inv>(a, b, c, d,
+            _mm512_maskz_loadu_ps(m, w1+i), _mm512_maskz_loadu_ps(m, w2+i), _mm512_maskz_loadu_ps(m, w3+i));
+        _mm512_mask_storeu_ps(A+i, m, a);
+        _mm512_mask_storeu_ps(B+i, m, b);
+        _mm512_mask_storeu_ps(C+i, m, c);
+        _mm512_mask_storeu_ps(D+i, m, d);
+        i = 2*quarter;
+    }
+#elif defined GENFFT_USE_AVX
+    for (; i+8<=2*quarter; i+=8)
+    {
+        __m256 a = _mm256_loadu_ps(A+i);
+        __m256 b = _mm256_loadu_ps(B+i);
+        __m256 c = _mm256_loadu_ps(C+i);
+        __m256 d = _mm256_loadu_ps(D+i);
+        radix4_dif_butterfly<inv>(a, b, c, d, _mm256_load_ps(w1+i), _mm256_load_ps(w2+i), _mm256_load_ps(w3+i));
+        _mm256_storeu_ps(A+i, a);
+        _mm256_storeu_ps(B+i, b);
+        _mm256_storeu_ps(C+i, c);
+        _mm256_storeu_ps(D+i, d);
+    }
+#endif
+    for (; i<2*quarter; i+=4)
+    {
+        __m128 a = _mm_loadu_ps(A+i);
+        __m128 b = _mm_loadu_ps(B+i);
+        __m128 c = _mm_loadu_ps(C+i);
+        __m128 d = _mm_loadu_ps(D+i);
+        radix4_dif_butterfly<inv>(a, b, c, d, _mm_load_ps(w1+i), _mm_load_ps(w2+i), _mm_load_ps(w3+i));
+        _mm_storeu_ps(A+i, a);
+        _mm_storeu_ps(B+i, b);
+        _mm_storeu_ps(C+i, c);
+        _mm_storeu_ps(D+i, d);
+    }
+}
+
+// DIF levels of 16 points and more are computed with radix-4 passes; smaller ones are generic
+template <int N, bool radix4 = (N >= 16)>
+struct FFTDIFFloat : impl_generic::FFTDIFGeneric<N, float> {};
+
+template <int N>
+struct FFTDIFFloat<N, true>
+{
+    FFTDIFFloat<N/4> next;
+    template <bool inv>
+    void transform_impl(float *data)
+    {
+        dif_radix4_pass<inv>(data, N/4, twiddle.w1(), twiddle.w2(), twiddle.w3());
+        next.template transform_impl<inv>(data);
+        next.template transform_impl<inv>(data+N/2);
+        next.template transform_impl<inv>(data+N);
+        next.template transform_impl<inv>(data+3*N/2);
+    }
+
+    const SharedTwiddle4<N, float> twiddle;
+};
+
+/// @brief Runtime-sized DIF FFT: radix-4 levels above a compile-time leaf transform
+template <>
+struct FFTDIFFloat<-1>
+{
+    FFTDIFFloat(int n, std::shared_ptr<impl::FFTDIFBase<float>> leaf) : N(n), leaf(std::move(leaf))
+    {
+        for (int size = this->leaf->size(); size <= N/4; size *= 4)
+            twiddle.emplace_back(4*size);
+        assert(this->leaf->size() << (2*twiddle.size()) == N);
+    }
+
+    template <bool inv>
+    void transform_impl(float *data)
+    {
+        transform_level<inv>(data, (int)twiddle.size() - 1);
+    }
+
+    int size() const noexcept { return N; }
+
+private:
+    template <bool inv>
+    void transform_level(float *data, int level)
+    {
+        if (level < 0)
+        {
+            leaf->template transform<inv>(data);
+            return;
+        }
+        const SharedTwiddle4<-1, float> &tw = twiddle[level];
+        const int quarter = tw.N/4;
+        dif_radix4_pass<inv>(data, quarter, tw.w1(), tw.w2(), tw.w3());
+        for (int i = 0; i < 4; i++)
+            transform_level<inv>(data + 2*(ptrdiff_t)i*quarter, level-1);
+    }
+
+    int N;
+    std::shared_ptr<impl::FFTDIFBase<float>> leaf;
+    std::vector<SharedTwiddle4<-1, float>> twiddle;
+};
+
+inline std::shared_ptr<impl::FFTDIFBase<float>> GetDIFImpl(int n, float)
+{
+    // DIF transforms support power-of-two sizes only
+    if (n <= 0 || (n & (n-1)) != 0)
+        return nullptr;
+    switch (n)
+    {
+#define SELECT_FFT_LEVEL(x) case (1<<x): \
+            if (x <= GENFFT_MAX_STATIC_LOG2) \
+                return impl::FFTDIFLevel<(1<<impl::static_log2(x)), float, FFTDIFFloat<(1<<impl::static_log2(x))>>::GetInstance(); \
+            break;
             SELECT_FFT_LEVEL(0);
             SELECT_FFT_LEVEL(1);
             SELECT_FFT_LEVEL(2);
@@ -528,6 +1072,8 @@ inline std::shared_ptr<impl::FFTVertBase<float>> GetVertImpl(int n, float)
             SELECT_FFT_LEVEL(23);
 #undef SELECT_FFT_LEVEL
         default:
-            assert(!"unsupported size");
+            break;
     }
+    // same leaf as the DIT transform - n / leaf is a power of 4
+    return impl::FFTDIFLevel<-1, float, FFTDIFFloat<-1>>::GetInstance(n, GetDIFImpl(FFTFloat<-1>::leaf_size(n), float()));
 }
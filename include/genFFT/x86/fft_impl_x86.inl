@@ -26,6 +26,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 // All implementations are aggregated here.
 
+#include "fft_mixed_radix_impl_x86.inl"
+#include "../generic/fft_bluestein_impl_generic.inl"
+#include "fft_stockham_impl_x86.inl"
+#include "../generic/fft_four_step_impl_generic.inl"
 #include "fft_float_impl_x86.inl"
 #include "fft_double_impl_x86.inl"
 #include "fft_dit_impl_x86.inl"
+#include "fft_pointwise_impl_x86.inl"
@@ -0,0 +1,148 @@
+/*
+Copyright 2026 Michal Zientkiewicz
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// SIMD helpers must be declared before the generic butterfly template that uses them
+#include "fft_x86_utils.h"
+#include "../generic/fft_mixed_radix_impl_generic.inl"
+
+template <>
+struct MixedRadixPass<float>
+{
+    template <int P, bool inv>
+    static void apply(float *data, int n, int m, const float *twiddle, const float *cs, const float *sn)
+    {
+        constexpr int H = (P-1)/2;
+#ifdef GENFFT_USE_AVX
+        __m256 cs8[H*H], sn8[H*H];
+        for (int i = 0; i < H*H; i++)
+        {
+            cs8[i] = _mm256_set1_ps(cs[i]);
+            sn8[i] = _mm256_set1_ps(sn[i]);
+        }
+#endif
+        __m128 cs4[H*H], sn4[H*H];
+        for (int i = 0; i < H*H; i++)
+        {
+            cs4[i] = _mm_set1_ps(cs[i]);
+            sn4[i] = _mm_set1_ps(sn[i]);
+        }
+
+        for (int g = 0; g < n; g += P*m)
+        {
+            float *group = data + 2*g;
+            int k = 0;
+#ifdef GENFFT_USE_AVX
+            for (; k + 4 <= m; k += 4)
+            {
+                __m256 v[P];
+                v[0] = _mm256_loadu_ps(group + 2*k);
+                for (int q = 1; q < P; q++)
+                {
+                    __m256 w = _mm256_loadu_ps(twiddle + 2*((q-1)*m + k));
+                    v[q] = complex_mul<inv>(_mm256_loadu_ps(group + 2*(q*m + k)), w);
+                }
+                odd_radix_butterfly<P, inv>(v, cs8, sn8);
+                for (int q = 0; q < P; q++)
+                    _mm256_storeu_ps(group + 2*(q*m + k), v[q]);
+            }
+#endif
+            for (; k + 2 <= m; k += 2)
+            {
+                __m128 v[P];
+                v[0] = _mm_loadu_ps(group + 2*k);
+                for (int q = 1; q < P; q++)
+                {
+                    __m128 w = _mm_loadu_ps(twiddle + 2*((q-1)*m + k));
+                    v[q] = complex_mul<inv>(_mm_loadu_ps(group + 2*(q*m + k)), w);
+                }
+                odd_radix_butterfly<P, inv>(v, cs4, sn4);
+                for (int q = 0; q < P; q++)
+                    _mm_storeu_ps(group + 2*(q*m + k), v[q]);
+            }
+            radix_butterflies_scalar<P, inv>(group, m, k, twiddle, cs, sn);
+        }
+    }
+};
+
+#ifdef GENFFT_USE_SSE2
+template <>
+struct MixedRadixPass<double>
+{
+    template <int P, bool inv>
+    static void apply(double *data, int n, int m, const double *twiddle, const double *cs, const double *sn)
+    {
+        constexpr int H = (P-1)/2;
+#ifdef GENFFT_USE_AVX
+        __m256d cs4[H*H], sn4[H*H];
+        for (int i = 0; i < H*H; i++)
+        {
+            cs4[i] = _mm256_set1_pd(cs[i]);
+            sn4[i] = _mm256_set1_pd(sn[i]);
+        }
+#endif
+        __m128d cs2[H*H], sn2[H*H];
+        for (int i = 0; i < H*H; i++)
+        {
+            cs2[i] = _mm_set1_pd(cs[i]);
+            sn2[i] = _mm_set1_pd(sn[i]);
+        }
+
+        for (int g = 0; g < n; g += P*m)
+        {
+            double *group = data + 2*g;
+            int k = 0;
+#ifdef GENFFT_USE_AVX
+            for (; k + 2 <= m; k += 2)
+            {
+                __m256d v[P];
+                v[0] = _mm256_loadu_pd(group + 2*k);
+                for (int q = 1; q < P; q++)
+                {
+                    __m256d w = _mm256_loadu_pd(twiddle + 2*((q-1)*m + k));
+                    v[q] = complex_mul<inv>(_mm256_loadu_pd(group + 2*(q*m + k)), w);
+                }
+                odd_radix_butterfly<P, inv>(v, cs4, sn4);
+                for (int q = 0; q < P; q++)
+                    _mm256_storeu_pd(group + 2*(q*m + k), v[q]);
+            }
+#endif
+            for (; k < m; k++)
+            {
+                __m128d v[P];
+                v[0] = _mm_loadu_pd(group + 2*k);
+                for (int q = 1; q < P; q++)
+                {
+                    __m128d w = _mm_loadu_pd(twiddle + 2*((q-1)*m + k));
+                    v[q] = complex_mul<inv>(_mm_loadu_pd(group + 2*(q*m + k)), w);
+                }
+                odd_radix_butterfly<P, inv>(v, cs2, sn2);
+                for (int q = 0; q < P; q++)
+                    _mm_storeu_pd(group + 2*(q*m + k), v[q]);
+            }
+        }
+    }
+};
+#endif
@@ -0,0 +1,164 @@
+/*
+Copyright 2026 Michal Zientkiewicz
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "../generic/fft_pointwise_impl_generic.inl"
+#include "fft_x86_utils.h"
+
+template <>
+inline void pointwise_mul_impl<float>(std::complex<float> *inout, const std::complex<float> *w, int n) noexcept
+{
+    float *x = (float *)inout;
+    const float *y = (const float *)w;
+    int i = 0;
+#ifdef GENFFT_USE_AVX512
+    for (; i+16 <= 2*n; i += 16)
+        _mm512_storeu_ps(x+i, complex_mul<false>(_mm512_loadu_ps(x+i), _mm512_loadu_ps(y+i)));
+    if (i < 2*n)
+    {
+        __mmask16 mask = first_lanes16(2*n - i);
+        __m512 v = complex_mul<false>(_mm512_maskz_loadu_ps(mask, x+i), _mm512_maskz_loadu_ps(mask, y+i));
+        _mm512_mask_storeu_ps(x+i, mask, v);
+        return;
+    }
+#endif
+#ifdef GENFFT_USE_AVX
+    for (; i+8 <= 2*n; i += 8)
+        _mm256_storeu_ps(x+i, complex_mul<false>(_mm256_loadu_ps(x+i), _mm256_loadu_ps(y+i)));
+#endif
+#ifdef GENFFT_USE_SSE
+    for (; i+4 <= 2*n; i += 4)
+        _mm_storeu_ps(x+i, complex_mul<false>(_mm_loadu_ps(x+i), _mm_loadu_ps(y+i)));
+#endif
+    for (; i < 2*n; i += 2)
+    {
+        float re = x[i]*y[i]   - x[i+1]*y[i+1];
+        float im = x[i]*y[i+1] + x[i+1]*y[i];
+        x[i]   = re;
+        x[i+1] = im;
+    }
+}
+
+template <>
+inline void pointwise_mul_impl<double>(std::complex<double> *inout, const std::complex<double> *w, int n) noexcept
+{
+    double *x = (double *)inout;
+    const double *y = (const double *)w;
+    int i = 0;
+#ifdef GENFFT_USE_AVX512
+    for (; i+8 <= 2*n; i += 8)
+        _mm512_storeu_pd(x+i, complex_mul<false>(_mm512_loadu_pd(x+i), _mm512_loadu_pd(y+i)));
+    if (i < 2*n)
+    {
+        __mmask8 mask = first_lanes8(2*n - i);
+        __m512d v = complex_mul<false>(_mm512_maskz_loadu_pd(mask, x+i), _mm512_maskz_loadu_pd(mask, y+i));
+        _mm512_mask_storeu_pd(x+i, mask, v);
+        return;
+    }
+#endif
+#ifdef GENFFT_USE_AVX
+    for (; i+4 <= 2*n; i += 4)
+        _mm256_storeu_pd(x+i, complex_mul<false>(_mm256_loadu_pd(x+i), _mm256_loadu_pd(y+i)));
+#endif
+#ifdef GENFFT_USE_SSE2
+    for (; i < 2*n; i += 2)
+        _mm_storeu_pd(x+i, complex_mul<false>(_mm_loadu_pd(x+i), _mm_loadu_pd(y+i)));
+#else
+    for (; i < 2*n; i += 2)
+    {
+        double re = x[i]*y[i]   - x[i+1]*y[i+1];
+        double im = x[i]*y[i+1] + x[i+1]*y[i];
+        x[i]   = re;
+        x[i+1] = im;
+    }
+#endif
+}
+
+template <>
+inline void pointwise_mul_add_impl<float>(std::complex<float> *acc, const std::complex<float> *x, const std::complex<float> *w, int n) noexcept
+{
+    float *a = (float *)acc;
+    const float *p = (const float *)x;
+    const float *q = (const float *)w;
+    int i = 0;
+#ifdef GENFFT_USE_AVX512
+    for (; i+16 <= 2*n; i += 16)
+        _mm512_storeu_ps(a+i, _mm512_add_ps(_mm512_loadu_ps(a+i), complex_mul<false>(_mm512_loadu_ps(p+i), _mm512_loadu_ps(q+i))));
+    if (i < 2*n)
+    {
+        __mmask16 mask = first_lanes16(2*n - i);
+        __m512 v = complex_mul<false>(_mm512_maskz_loadu_ps(mask, p+i), _mm512_maskz_loadu_ps(mask, q+i));
+        _mm512_mask_storeu_ps(a+i, mask, _mm512_add_ps(_mm512_maskz_loadu_ps(mask, a+i), v));
+        return;
+    }
+#endif
+#ifdef GENFFT_USE_AVX
+    for (; i+8 <= 2*n; i += 8)
+        _mm256_storeu_ps(a+i, _mm256_add_ps(_mm256_loadu_ps(a+i), complex_mul<false>(_mm256_loadu_ps(p+i), _mm256_loadu_ps(q+i))));
+#endif
+#ifdef GENFFT_USE_SSE
+    for (; i+4 <= 2*n; i += 4)
+        _mm_storeu_ps(a+i, _mm_add_ps(_mm_loadu_ps(a+i), complex_mul<false>(_mm_loadu_ps(p+i), _mm_loadu_ps(q+i))));
+#endif
+    for (; i < 2*n; i += 2)
+    {
+        a[i]   += p[i]*q[i]   - p[i+1]*q[i+1];
+        a[i+1] += p[i]*q[i+1] + p[i+1]*q[i];
+    }
+}
+
+template <>
+inline void pointwise_mul_add_impl<double>(std::complex<double> *acc, const std::complex<double> *x, const std::complex<double> *w, int n) noexcept
+{
+    double *a = (double *)acc;
+    const double *p = (const double *)x;
+    const double *q = (const double *)w;
+    int i = 0;
+#ifdef GENFFT_USE_AVX512
+    for (; i+8 <= 2*n; i += 8)
+        _mm512_storeu_pd(a+i, _mm512_add_pd(_mm512_loadu_pd(a+i), complex_mul<false>(_mm512_loadu_pd(p+i), _mm512_loadu_pd(q+i))));
+    if (i < 2*n)
+    {
+        __mmask8 mask = first_lanes8(2*n - i);
+        __m512d v = complex_mul<false>(_mm512_maskz_loadu_pd(mask, p+i), _mm512_maskz_loadu_pd(mask, q+i));
+        _mm512_mask_storeu_pd(a+i, mask, _mm512_add_pd(_mm512_maskz_loadu_pd(mask, a+i), v));
+        return;
+    }
+#endif
+#ifdef GENFFT_USE_AVX
+    for (; i+4 <= 2*n; i += 4)
+        _mm256_storeu_pd(a+i, _mm256_add_pd(_mm256_loadu_pd(a+i), complex_mul<false>(_mm256_loadu_pd(p+i), _mm256_loadu_pd(q+i))));
+#endif
+#ifdef GENFFT_USE_SSE2
+    for (; i < 2*n; i += 2)
+        _mm_storeu_pd(a+i, _mm_add_pd(_mm_loadu_pd(a+i), complex_mul<false>(_mm_loadu_pd(p+i), _mm_loadu_pd(q+i))));
+#else
+    for (; i < 2*n; i += 2)
+    {
+        a[i]   += p[i]*q[i]   - p[i+1]*q[i+1];
+        a[i+1] += p[i]*q[i+1] + p[i+1]*q[i];
+    }
+#endif
+}
@@ -0,0 +1,329 @@
+/*
+Copyright 2026 Michal Zientkiewicz
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "fft_x86_utils.h"
+#include "../generic/fft_stockham_impl_generic.inl"
+
+/// @brief Radix-4 Stockham butterfly on interleaved complex vectors
+template <bool inv, class V>
+inline void stockham4_butterfly(V &a, V &b, V &c, V &d, V w1, V w2, V w3)
+{
+    V apc = a + c;
+    V amc = a - c;
+    V bpd = b + d;
+    V bmd = rotate90<inv>(b - d);
+    a = apc + bpd;
+    b = complex_mul<inv>(amc + bmd, w1);
+    c = complex_mul<inv>(apc - bpd, w2);
+    d = complex_mul<inv>(amc - bmd, w3);
+}
+
+template <>
+struct StockhamPass<float>
+{
+    template <bool inv>
+    static void apply4(float *y, const float *x, int n, int s, const float *w1, const float *w2, const float *w3)
+    {
+        const int m = n / (4*s);
+        if (s == 1)
+        {
+            // Contiguous twiddles, the four results of each butterfly are stored next to each other
+            int p = 0;
+#ifdef GENFFT_USE_AVX
+            for (; p+4 <= m; p += 4)
+            {
+                __m256 a = _mm256_loadu_ps(x + 2*p);
+                __m256 b = _mm256_loadu_ps(x + 2*(p + m));
+                __m256 c = _mm256_loadu_ps(x + 2*(p + 2*m));
+                __m256 d = _mm256_loadu_ps(x + 2*(p + 3*m));
+                stockham4_butterfly<inv>(a, b, c, d,
+                    _mm256_loadu_ps(w1 + 2*p), _mm256_loadu_ps(w2 + 2*p), _mm256_loadu_ps(w3 + 2*p));
+                // transpose 4x4 complex numbers
+                __m256d t0 = _mm256_unpacklo_pd(_mm256_castps_pd(a), _mm256_castps_pd(b));
+                __m256d t1 = _mm256_unpackhi_pd(_mm256_castps_pd(a), _mm256_castps_pd(b));
+                __m256d t2 = _mm256_unpacklo_pd(_mm256_castps_pd(c), _mm256_castps_pd(d));
+                __m256d t3 = _mm256_unpackhi_pd(_mm256_castps_pd(c), _mm256_castps_pd(d));
+                _mm256_storeu_ps(y + 8*(ptrdiff_t)p,      _mm256_castpd_ps(_mm256_permute2f128_pd(t0, t2, 0x20)));
+                _mm256_storeu_ps(y + 8*(ptrdiff_t)p + 8,  _mm256_castpd_ps(_mm256_permute2f128_pd(t1, t3, 0x20)));
+                _mm256_storeu_ps(y + 8*(ptrdiff_t)p + 16, _mm256_castpd_ps(_mm256_permute2f128_pd(t0, t2, 0x31)));
+                _mm256_storeu_ps(y + 8*(ptrdiff_t)p + 24, _mm256_castpd_ps(_mm256_permute2f128_pd(t1, t3, 0x31)));
+            }
+#endif
+            for (; p+2 <= m; p += 2)
+            {
+                __m128 a = _mm_loadu_ps(x + 2*p);
+                __m128 b = _mm_loadu_ps(x + 2*(p + m));
+                __m128 c = _mm_loadu_ps(x + 2*(p + 2*m));
+                __m128 d = _mm_loadu_ps(x + 2*(p + 3*m));
+                stockham4_butterfly<inv>(a, b, c, d,
+                    _mm_loadu_ps(w1 + 2*p), _mm_loadu_ps(w2 + 2*p), _mm_loadu_ps(w3 + 2*p));
+                _mm_storeu_ps(y + 8*(ptrdiff_t)p,      _mm_movelh_ps(a, b));
+                _mm_storeu_ps(y + 8*(ptrdiff_t)p + 4,  _mm_movelh_ps(c, d));
+                _mm_storeu_ps(y + 8*(ptrdiff_t)p + 8,  _mm_movehl_ps(b, a));
+                _mm_storeu_ps(y + 8*(ptrdiff_t)p + 12, _mm_movehl_ps(d, c));
+            }
+            stockham4_butterflies_scalar<inv>(y, x, n, s, w1, w2, w3, p);
+            return;
+        }
+
+        const float *x1 = x + 2*m*s, *x2 = x1 + 2*m*s, *x3 = x2 + 2*m*s;
+        for (int p = 0; p < m; p++)
+        {
+            const int in_ofs = 2*p*s;
+            float *y0 = y + 8*(ptrdiff_t)p*s;
+            float *y1 = y0 + 2*s, *y2 = y1 + 2*s, *y3 = y2 + 2*s;
+            int q = 0;
+#ifdef GENFFT_USE_AVX
+            __m256 W1 = _mm256_castpd_ps(_mm256_broadcast_sd((const double *)(w1 + 2*p)));
+            __m256 W2 = _mm256_castpd_ps(_mm256_broadcast_sd((const double *)(w2 + 2*p)));
+            __m256 W3 = _mm256_castpd_ps(_mm256_broadcast_sd((const double *)(w3 + 2*p)));
+            for (; q+8 <= 2*s; q += 8)
+            {
+                __m256 a = _mm256_loadu_ps(x  + in_ofs + q);
+                __m256 b = _mm256_loadu_ps(x1 + in_ofs + q);
+                __m256 c = _mm256_loadu_ps(x2 + in_ofs + q);
+                __m256 d = _mm256_loadu_ps(x3 + in_ofs + q);
+                stockham4_butterfly<inv>(a, b, c, d, W1, W2, W3);
+                _mm256_storeu_ps(y0 + q, a);
+                _mm256_storeu_ps(y1 + q, b);
+                _mm256_storeu_ps(y2 + q, c);
+                _mm256_storeu_ps(y3 + q, d);
+            }
+#endif
+            __m128 W1_128 = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(w1 + 2*p));
+            __m128 W2_128 = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(w2 + 2*p));
+            __m128 W3_128 = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(w3 + 2*p));
+            W1_128 = _mm_movelh_ps(W1_128, W1_128);
+            W2_128 = _mm_movelh_ps(W2_128, W2_128);
+            W3_128 = _mm_movelh_ps(W3_128, W3_128);
+            for (; q < 2*s; q += 4)
+            {
+                __m128 a = _mm_loadu_ps(x  + in_ofs + q);
+                __m128 b = _mm_loadu_ps(x1 + in_ofs + q);
+                __m128 c = _mm_loadu_ps(x2 + in_ofs + q);
+                __m128 d = _mm_loadu_ps(x3 + in_ofs + q);
+                stockham4_butterfly<inv>(a, b, c, d, W1_128, W2_128, W3_128);
+                _mm_storeu_ps(y0 + q, a);
+                _mm_storeu_ps(y1 + q, b);
+                _mm_storeu_ps(y2 + q, c);
+                _mm_storeu_ps(y3 + q, d);
+            }
+        }
+    }
+
+    template <bool inv>
+    static void apply(float *y, const float *x, int n, int s, const float *twiddle)
+    {
+        const int m = n / (2*s);
+        const float *x1 = x + 2*m*s;
+        if (s == 1)
+        {
+            // Contiguous twiddles, the results are interleaved: y[2p] = sum, y[2p+1] = difference
+            int p = 0;
+#ifdef GENFFT_USE_AVX
+            for (; p+4 <= m; p += 4)
+            {
+                __m256 a = _mm256_loadu_ps(x + 2*p);
+                __m256 b = _mm256_loadu_ps(x1 + 2*p);
+                __m256 sum  = _mm256_add_ps(a, b);
+                __m256 diff = complex_mul<inv>(_mm256_sub_ps(a, b), _mm256_loadu_ps(twiddle + 2*p));
+                __m256d u0 = _mm256_unpacklo_pd(_mm256_castps_pd(sum), _mm256_castps_pd(diff));
+                __m256d u1 = _mm256_unpackhi_pd(_mm256_castps_pd(sum), _mm256_castps_pd(diff));
+                _mm256_storeu_ps(y + 4*(ptrdiff_t)p,     _mm256_castpd_ps(_mm256_permute2f128_pd(u0, u1, 0x20)));
+                _mm256_storeu_ps(y + 4*(ptrdiff_t)p + 8, _mm256_castpd_ps(_mm256_permute2f128_pd(u0, u1, 0x31)));
+            }
+#endif
+            for (; p+2 <= m; p += 2)
+            {
+                __m128 a = _mm_loadu_ps(x + 2*p);
+                __m128 b = _mm_loadu_ps(x1 + 2*p);
+                __m128 sum  = _mm_add_ps(a, b);
+                __m128 diff = complex_mul<inv>(_mm_sub_ps(a, b), _mm_loadu_ps(twiddle + 2*p));
+                _mm_storeu_ps(y + 4*(ptrdiff_t)p,     _mm_movelh_ps(sum, diff));
+                _mm_storeu_ps(y + 4*(ptrdiff_t)p + 4, _mm_movehl_ps(diff, sum));
+            }
+            stockham_butterflies_scalar<inv>(y, x, n, s, twiddle, p);
+            return;
+        }
+
+        for (int p = 0; p < m; p++)
+        {
+            const float *a = x + 2*p*s;
+            const float *b = x1 + 2*p*s;
+            float *y0 = y + 4*(ptrdiff_t)p*s;
+            float *y1 = y0 + 2*s;
+            int q = 0;
+#ifdef GENFFT_USE_AVX
+            __m256 W = _mm256_castpd_ps(_mm256_broadcast_sd((const double *)(twiddle + 2*p*s)));
+            for (; q+8 <= 2*s; q += 8)
+            {
+                __m256 A = _mm256_loadu_ps(a + q);
+                __m256 B = _mm256_loadu_ps(b + q);
+                _mm256_storeu_ps(y0 + q, _mm256_add_ps(A, B));
+                _mm256_storeu_ps(y1 + q, complex_mul<inv>(_mm256_sub_ps(A, B), W));
+            }
+            __m128 W128 = _mm256_castps256_ps128(W);
+#else
+            __m128 W128 = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(twiddle + 2*p*s));
+            W128 = _mm_movelh_ps(W128, W128);
+#endif
+            for (; q < 2*s; q += 4)
+            {
+                __m128 A = _mm_loadu_ps(a + q);
+                __m128 B = _mm_loadu_ps(b + q);
+                _mm_storeu_ps(y0 + q, _mm_add_ps(A, B));
+                _mm_storeu_ps(y1 + q, complex_mul<inv>(_mm_sub_ps(A, B), W128));
+            }
+        }
+    }
+};
+
+#ifdef GENFFT_USE_SSE2
+template <>
+struct StockhamPass<double>
+{
+    template <bool inv>
+    static void apply4(double *y, const double *x, int n, int s, const double *w1, const double *w2, const double *w3)
+    {
+        const int m = n / (4*s);
+#ifdef GENFFT_USE_AVX
+        if (s == 1)
+        {
+            // Contiguous twiddles, the four results of each butterfly are stored next to each other
+            int p = 0;
+            for (; p+2 <= m; p += 2)
+            {
+                __m256d a = _mm256_loadu_pd(x + 2*p);
+                __m256d b = _mm256_loadu_pd(x + 2*(p + m));
+                __m256d c = _mm256_loadu_pd(x + 2*(p + 2*m));
+                __m256d d = _mm256_loadu_pd(x + 2*(p + 3*m));
+                stockham4_butterfly<inv>(a, b, c, d,
+                    _mm256_loadu_pd(w1 + 2*p), _mm256_loadu_pd(w2 + 2*p), _mm256_loadu_pd(w3 + 2*p));
+                _mm256_storeu_pd(y + 8*(ptrdiff_t)p,      _mm256_permute2f128_pd(a, b, 0x20));
+                _mm256_storeu_pd(y + 8*(ptrdiff_t)p + 4,  _mm256_permute2f128_pd(c, d, 0x20));
+                _mm256_storeu_pd(y + 8*(ptrdiff_t)p + 8,  _mm256_permute2f128_pd(a, b, 0x31));
+                _mm256_storeu_pd(y + 8*(ptrdiff_t)p + 12, _mm256_permute2f128_pd(c, d, 0x31));
+            }
+            stockham4_butterflies_scalar<inv>(y, x, n, s, w1, w2, w3, p);
+            return;
+        }
+#endif
+
+        const double *x1 = x + 2*m*s, *x2 = x1 + 2*m*s, *x3 = x2 + 2*m*s;
+        for (int p = 0; p < m; p++)
+        {
+            const int in_ofs = 2*p*s;
+            double *y0 = y + 8*(ptrdiff_t)p*s;
+            double *y1 = y0 + 2*s, *y2 = y1 + 2*s, *y3 = y2 + 2*s;
+            int q = 0;
+#ifdef GENFFT_USE_AVX
+            __m256d W1 = _mm256_broadcast_pd((const __m128d *)(w1 + 2*p));
+            __m256d W2 = _mm256_broadcast_pd((const __m128d *)(w2 + 2*p));
+            __m256d W3 = _mm256_broadcast_pd((const __m128d *)(w3 + 2*p));
+            for (; q+4 <= 2*s; q += 4)
+            {
+                __m256d a = _mm256_loadu_pd(x  + in_ofs + q);
+                __m256d b = _mm256_loadu_pd(x1 + in_ofs + q);
+                __m256d c = _mm256_loadu_pd(x2 + in_ofs + q);
+                __m256d d = _mm256_loadu_pd(x3 + in_ofs + q);
+                stockham4_butterfly<inv>(a, b, c, d, W1, W2, W3);
+                _mm256_storeu_pd(y0 + q, a);
+                _mm256_storeu_pd(y1 + q, b);
+                _mm256_storeu_pd(y2 + q, c);
+                _mm256_storeu_pd(y3 + q, d);
+            }
+#endif
+            __m128d W1_128 = _mm_loadu_pd(w1 + 2*p);
+            __m128d W2_128 = _mm_loadu_pd(w2 + 2*p);
+            __m128d W3_128 = _mm_loadu_pd(w3 + 2*p);
+            for (; q < 2*s; q += 2)
+            {
+                __m128d a = _mm_loadu_pd(x  + in_ofs + q);
+                __m128d b = _mm_loadu_pd(x1 + in_ofs + q);
+                __m128d c = _mm_loadu_pd(x2 + in_ofs + q);
+                __m128d d = _mm_loadu_pd(x3 + in_ofs + q);
+                stockham4_butterfly<inv>(a, b, c, d, W1_128, W2_128, W3_128);
+                _mm_storeu_pd(y0 + q, a);
+                _mm_storeu_pd(y1 + q, b);
+                _mm_storeu_pd(y2 + q, c);
+                _mm_storeu_pd(y3 + q, d);
+            }
+        }
+    }
+
+    template <bool inv>
+    static void apply(double *y, const double *x, int n, int s, const double *twiddle)
+    {
+        const int m = n / (2*s);
+        const double *x1 = x + 2*m*s;
+#ifdef GENFFT_USE_AVX
+        if (s == 1)
+        {
+            // Contiguous twiddles, the results are interleaved: y[2p] = sum, y[2p+1] = difference
+            int p = 0;
+            for (; p+2 <= m; p += 2)
+            {
+                __m256d a = _mm256_loadu_pd(x + 2*p);
+                __m256d b = _mm256_loadu_pd(x1 + 2*p);
+                __m256d sum  = _mm256_add_pd(a, b);
+                __m256d diff = complex_mul<inv>(_mm256_sub_pd(a, b), _mm256_loadu_pd(twiddle + 2*p));
+                _mm256_storeu_pd(y + 4*(ptrdiff_t)p,     _mm256_permute2f128_pd(sum, diff, 0x20));
+                _mm256_storeu_pd(y + 4*(ptrdiff_t)p + 4, _mm256_permute2f128_pd(sum, diff, 0x31));
+            }
+            stockham_butterflies_scalar<inv>(y, x, n, s, twiddle, p);
+            return;
+        }
+#endif
+
+        for (int p = 0; p < m; p++)
+        {
+            const double *a = x + 2*p*s;
+            const double *b = x1 + 2*p*s;
+            double *y0 = y + 4*(ptrdiff_t)p*s;
+            double *y1 = y0 + 2*s;
+            int q = 0;
+#ifdef GENFFT_USE_AVX
+            __m256d W = _mm256_broadcast_pd((const __m128d *)(twiddle + 2*p*s));
+            for (; q+4 <= 2*s; q += 4)
+            {
+                __m256d A = _mm256_loadu_pd(a + q);
+                __m256d B = _mm256_loadu_pd(b + q);
+                _mm256_storeu_pd(y0 + q, _mm256_add_pd(A, B));
+                _mm256_storeu_pd(y1 + q, complex_mul<inv>(_mm256_sub_pd(A, B), W));
+            }
+#endif
+            __m128d W128 = _mm_loadu_pd(twiddle + 2*p*s);
+            for (; q < 2*s; q += 2)
+            {
+                __m128d A = _mm_loadu_pd(a + q);
+                __m128d B = _mm_loadu_pd(b + q);
+                _mm_storeu_pd(y0 + q, _mm_add_pd(A, B));
+                _mm_storeu_pd(y1 + q, complex_mul<inv>(_mm_sub_pd(A, B), W128));
+            }
+        }
+    }
+};
+#endif
@@ -33,13 +33,48 @@ namespace impl_x86_dispatch {
 std::shared_ptr<impl::FFTBase<float>> GetImpl(int n, float);
 std::shared_ptr<impl::FFTBase<double>> GetImpl(int n, double);
 
+std::shared_ptr<impl::FFTBase<float>> GetTunedImpl(int n, float);
+std::shared_ptr<impl::FFTBase<double>> GetTunedImpl(int n, double);
+
+std::shared_ptr<impl::FFTBase<float>> GetStockhamImpl(int n, float);
+std::shared_ptr<impl::FFTBase<double>> GetStockhamImpl(int n, double);
+
 std::shared_ptr<impl::FFTVertBase<float>> GetVertImpl(int n, float);
 std::shared_ptr<impl::FFTVertBase<double>> GetVertImpl(int n, double);
 
 std::shared_ptr<impl::FFTDITBase<float>> GetDITImpl(int n, float);
 std::shared_ptr<impl::FFTDITBase<double>> GetDITImpl(int n, double);
 
+std::shared_ptr<impl::FFTDIFBase<float>> GetDIFImpl(int n, float);
+std::shared_ptr<impl::FFTDIFBase<double>> GetDIFImpl(int n, double);
+
+std::shared_ptr<impl::FFTPointwiseBase<float>> GetPointwiseImpl(float);
+std::shared_ptr<impl::FFTPointwiseBase<double>> GetPointwiseImpl(double);
+
 } // impl_x86_dispatch
+
+/// @brief Times the implementations of an n-point 1D FFT available on this machine
+///        (ISA and algorithm) and records the fastest one in the wisdom.
+///        FFT objects created afterwards use it to transform naturally ordered data
+///        (transform, transform_inplace, RealFFT::inverse). transform_no_scramble and the
+///        engines built on it keep the default algorithm, which expects reordered input,
+///        and use the recorded ISA only if the default algorithm won.
+void AutotuneFFT(int n, float);
+void AutotuneFFT(int n, double);
+
+/// @brief Writes the wisdom to a file
+/// @return true on success
+bool SaveWisdom(const char *path);
+
+/// @brief Adds the wisdom from a file written by SaveWisdom.
+///        The file named by the GENFFT_WISDOM environment variable is loaded at startup.
+///        Choices for instruction sets the CPU doesn't support are ignored.
+/// @return false if the file cannot be read or contains invalid entries
+bool LoadWisdom(const char *path);
+
+/// @brief Discards all wisdom
+void ForgetWisdom();
+
 } // genfft
 
 #endif /* GENFFT_X86_DISPATCH_H */
@@ -29,6 +29,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "fft_x86_preproc.h"
 #include "../FFTTwiddle.h"
+#include "../FFTLevel.h"
+#include <complex>
+#include <vector>
 
 namespace genfft {
 namespace impl_native {
@@ -46,7 +46,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #endif
 
-#if defined(__AVX__) || defined(__AVX2__) || defined(__FMA__)
+#if defined(__AVX__) || defined(__AVX2__) || defined(__FMA__) || defined(__AVX512F__)
 #include <immintrin.h>
 #endif
 
@@ -61,3 +61,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifdef __AVX2__
 #define GENFFT_USE_AVX2
 #endif
+
+#ifdef __AVX512F__
+#define GENFFT_USE_AVX512
+#endif
+
+#ifdef __AVX512DQ__
+#define GENFFT_USE_AVX512DQ
+#endif
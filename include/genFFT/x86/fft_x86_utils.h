@@ -109,6 +109,90 @@ inline __m128 permute(__m128 x)
 }
 #endif
 
+/// @brief Multiplies interleaved complex numbers x by w (or by conj(w), if inv is true)
+template <bool inv>
+inline __m128 complex_mul(__m128 x, __m128 w)
+{
+#ifdef GENFFT_USE_SSE3
+    __m128 wr = _mm_moveldup_ps(w);
+    __m128 wi = _mm_movehdup_ps(w);
+#else
+    __m128 wr = _mm_shuffle_ps(w, w, _MM_SHUFFLE(2, 2, 0, 0));
+    __m128 wi = _mm_shuffle_ps(w, w, _MM_SHUFFLE(3, 3, 1, 1));
+#endif
+    __m128 xwi = permute<_MM_SHUFFLE(2, 3, 0, 1)>(_mm_mul_ps(x, wi));
+#ifdef GENFFT_USE_FMA
+    return inv ? _mm_fmsubadd_ps(x, wr, xwi) : _mm_fmaddsub_ps(x, wr, xwi);
+#else
+    __m128 xwr = _mm_mul_ps(x, wr);
+    return inv ? subadd(xwr, xwi) : addsub(xwr, xwi);
+#endif
+}
+
+/// @brief Multiplies interleaved complex numbers by -i (or by i, if inv is true)
+template <bool inv>
+inline __m128 rotate90(__m128 x)
+{
+    x = permute<_MM_SHUFFLE(2, 3, 0, 1)>(x);
+    return inv ? flip_even(x) : flip_odd(x);
+}
+
+#ifdef GENFFT_USE_AVX
+template <bool inv>
+inline __m256 complex_mul(__m256 x, __m256 w)
+{
+    __m256 wr = _mm256_moveldup_ps(w);
+    __m256 wi = _mm256_movehdup_ps(w);
+    __m256 xwi = _mm256_permute_ps(_mm256_mul_ps(x, wi), _MM_SHUFFLE(2, 3, 0, 1));
+#ifdef GENFFT_USE_FMA
+    return inv ? _mm256_fmsubadd_ps(x, wr, xwi) : _mm256_fmaddsub_ps(x, wr, xwi);
+#else
+    __m256 xwr = _mm256_mul_ps(x, wr);
+    return _mm256_addsub_ps(xwr, inv ? -xwi : xwi);
+#endif
+}
+
+template <bool inv>
+inline __m256 rotate90(__m256 x)
+{
+    x = _mm256_permute_ps(x, _MM_SHUFFLE(2, 3, 0, 1));
+    return inv ? flip_even(x) : flip_odd(x);
+}
+#endif
+
+#ifdef GENFFT_USE_AVX512
+inline __m512 flip_even(__m512 a)
+{
+    return _mm512_mask_sub_ps(a, 0x5555, _mm512_setzero_ps(), a);
+}
+inline __m512 flip_odd(__m512 a)
+{
+    return _mm512_mask_sub_ps(a, 0xaaaa, _mm512_setzero_ps(), a);
+}
+
+template <bool inv>
+inline __m512 complex_mul(__m512 x, __m512 w)
+{
+    __m512 wr = _mm512_moveldup_ps(w);
+    __m512 wi = _mm512_movehdup_ps(w);
+    __m512 xwi = _mm512_permute_ps(_mm512_mul_ps(x, wi), _MM_SHUFFLE(2, 3, 0, 1));
+    return inv ? _mm512_fmsubadd_ps(x, wr, xwi) : _mm512_fmaddsub_ps(x, wr, xwi);
+}
+
+template <bool inv>
+inline __m512 rotate90(__m512 x)
+{
+    x = _mm512_permute_ps(x, _MM_SHUFFLE(2, 3, 0, 1));
+    return inv ? flip_even(x) : flip_odd(x);
+}
+
+/// @brief Mask of the first n of 16 float lanes
+inline __mmask16 first_lanes16(int n)
+{
+    return (__mmask16)((1u << n) - 1);
+}
+#endif
+
 ////////////////////////////////////////////////////////////////////
 
 
@@ -195,4 +279,128 @@ inline __m128d permute(__m128d x)
 }
 #endif
 
+template <bool inv>
+inline __m128d complex_mul(__m128d x, __m128d w)
+{
+    __m128d wr = _mm_shuffle_pd(w, w, _MM_SHUFFLE2(0, 0));
+    __m128d wi = _mm_shuffle_pd(w, w, _MM_SHUFFLE2(1, 1));
+    __m128d xwi = permute<_MM_SHUFFLE2(0, 1)>(_mm_mul_pd(x, wi));
+#ifdef GENFFT_USE_FMA
+    return inv ? _mm_fmsubadd_pd(x, wr, xwi) : _mm_fmaddsub_pd(x, wr, xwi);
+#else
+    __m128d xwr = _mm_mul_pd(x, wr);
+    return inv ? subadd(xwr, xwi) : addsub(xwr, xwi);
+#endif
+}
+
+template <bool inv>
+inline __m128d rotate90(__m128d x)
+{
+    x = permute<_MM_SHUFFLE2(0, 1)>(x);
+    return inv ? flip_even(x) : flip_odd(x);
+}
+
+#ifdef GENFFT_USE_AVX
+template <bool inv>
+inline __m256d complex_mul(__m256d x, __m256d w)
+{
+    __m256d wr = _mm256_permute_pd(w, _MM_SHUFFLE4x2(0, 0, 0, 0));
+    __m256d wi = _mm256_permute_pd(w, _MM_SHUFFLE4x2(1, 1, 1, 1));
+    __m256d xwi = _mm256_permute_pd(_mm256_mul_pd(x, wi), _MM_SHUFFLE4x2(0, 1, 0, 1));
+#ifdef GENFFT_USE_FMA
+    return inv ? _mm256_fmsubadd_pd(x, wr, xwi) : _mm256_fmaddsub_pd(x, wr, xwi);
+#else
+    __m256d xwr = _mm256_mul_pd(x, wr);
+    return _mm256_addsub_pd(xwr, inv ? -xwi : xwi);
+#endif
+}
+
+template <bool inv>
+inline __m256d rotate90(__m256d x)
+{
+    x = _mm256_permute_pd(x, _MM_SHUFFLE4x2(0, 1, 0, 1));
+    return inv ? flip_even(x) : flip_odd(x);
+}
+#endif
+
+#ifdef GENFFT_USE_AVX512
+inline __m512d flip_even(__m512d a)
+{
+#ifdef GENFFT_USE_AVX512DQ
+    const __m512d signmask = _mm512_castsi512_pd(_mm512_set_epi64(0, 1ull<<63, 0, 1ull<<63, 0, 1ull<<63, 0, 1ull<<63));
+    return _mm512_xor_pd(a, signmask);
+#else
+    return _mm512_mask_sub_pd(a, 0x55, _mm512_setzero_pd(), a);
+#endif
+}
+inline __m512d flip_odd(__m512d a)
+{
+#ifdef GENFFT_USE_AVX512DQ
+    const __m512d signmask = _mm512_castsi512_pd(_mm512_set_epi64(1ull<<63, 0, 1ull<<63, 0, 1ull<<63, 0, 1ull<<63, 0));
+    return _mm512_xor_pd(a, signmask);
+#else
+    return _mm512_mask_sub_pd(a, 0xaa, _mm512_setzero_pd(), a);
+#endif
+}
+
+template <bool inv>
+inline __m512d complex_mul(__m512d x, __m512d w)
+{
+    __m512d wr = _mm512_movedup_pd(w);
+    __m512d wi = _mm512_permute_pd(w, 0xff);
+    __m512d xwi = _mm512_permute_pd(_mm512_mul_pd(x, wi), 0x55);
+    return inv ? _mm512_fmsubadd_pd(x, wr, xwi) : _mm512_fmaddsub_pd(x, wr, xwi);
+}
+
+template <bool inv>
+inline __m512d rotate90(__m512d x)
+{
+    x = _mm512_permute_pd(x, 0x55);
+    return inv ? flip_even(x) : flip_odd(x);
+}
+
+/// @brief Mask of the first n of 8 double lanes
+inline __mmask8 first_lanes8(int n)
+{
+    return (__mmask8)((1u << n) - 1);
+}
+#endif
+
+////////////////////////////////////////////////////////////////////
+
+/// @brief Radix-4 butterfly on interleaved complex vectors; a, b, c, d are the
+///        transforms of the 1st, 2nd, 3rd and 4th quarter of the bit-reversed input
+template <bool inv, class V>
+inline void radix4_butterfly(V &a, V &b, V &c, V &d, V w1, V w2, V w3)
+{
+    b = complex_mul<inv>(b, w2);
+    c = complex_mul<inv>(c, w1);
+    d = complex_mul<inv>(d, w3);
+    V t0 = a + b;
+    V t1 = a - b;
+    V t2 = c + d;
+    V t3 = rotate90<inv>(c - d);
+    a = t0 + t2;
+    b = t1 + t3;
+    c = t0 - t2;
+    d = t1 - t3;
+}
+
+/// @brief Radix-4 decimation-in-frequency butterfly on interleaved complex vectors;
+///        a, b, c, d are taken from the 1st, 2nd, 3rd and 4th quarter of the input
+///        and replaced with the inputs of the 1st, 2nd, 3rd and 4th sub-transform,
+///        which produce the bit-reversed quarters of the output
+template <bool inv, class V>
+inline void radix4_dif_butterfly(V &a, V &b, V &c, V &d, V w1, V w2, V w3)
+{
+    V t0 = a + c;
+    V t1 = a - c;
+    V t2 = b + d;
+    V t3 = rotate90<inv>(b - d);
+    a = t0 + t2;
+    b = complex_mul<inv>(t0 - t2, w2);
+    c = complex_mul<inv>(t1 + t3, w1);
+    d = complex_mul<inv>(t1 - t3, w3);
+}
+
 #endif // GENFFT_X86_UTILS
@@ -40,6 +40,8 @@ struct cpu_features
     bool AVX    : 1;
     bool AVX2   : 1;
     bool FMA    : 1;
+    bool AVX512F  : 1;
+    bool AVX512DQ : 1;
 };
 
 cpu_features GetCPUFeatures();
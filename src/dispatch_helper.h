@@ -10,27 +10,43 @@ template <typename T>
 using FFTVertImplPtr = std::shared_ptr<impl::FFTVertBase<T>>;
 template <typename T>
 using FFTDITImplPtr = std::shared_ptr<impl::FFTDITBase<T>>;
+template <typename T>
+using FFTDIFImplPtr = std::shared_ptr<impl::FFTDIFBase<T>>;
+template <typename T>
+using FFTPointwiseImplPtr = std::shared_ptr<impl::FFTPointwiseBase<T>>;
 
 } // genfft
 
 #define IMPORT_NAMESPACE(name) namespace name { \
 std::shared_ptr<impl::FFTBase<float>> GetDispatchImpl(int n, float);            \
 std::shared_ptr<impl::FFTBase<double>> GetDispatchImpl(int n, double);          \
+std::shared_ptr<impl::FFTBase<float>> GetStockhamDispatchImpl(int n, float);    \
+std::shared_ptr<impl::FFTBase<double>> GetStockhamDispatchImpl(int n, double);  \
 std::shared_ptr<impl::FFTVertBase<float>> GetVertDispatchImpl(int n, float);    \
 std::shared_ptr<impl::FFTVertBase<double>> GetVertDispatchImpl(int n, double);  \
 std::shared_ptr<impl::FFTDITBase<float>> GetDITDispatchImpl(int n, float);    \
 std::shared_ptr<impl::FFTDITBase<double>> GetDITDispatchImpl(int n, double);  \
+std::shared_ptr<impl::FFTDIFBase<float>> GetDIFDispatchImpl(int n, float);      \
+std::shared_ptr<impl::FFTDIFBase<double>> GetDIFDispatchImpl(int n, double);    \
+std::shared_ptr<impl::FFTPointwiseBase<float>> GetPointwiseDispatchImpl(float);   \
+std::shared_ptr<impl::FFTPointwiseBase<double>> GetPointwiseDispatchImpl(double); \
 }
 
 #define DISPATCH(type)\
 genfft::FFTImplPtr<type> GetDispatchImpl(int n, type dummy)  { return GetImpl(n, dummy); } \
+genfft::FFTImplPtr<type> GetStockhamDispatchImpl(int n, type dummy)  { return GetStockhamImpl(n, dummy); } \
 genfft::FFTVertImplPtr<type> GetVertDispatchImpl(int n, type dummy)  { return GetVertImpl(n, dummy); } \
 genfft::FFTDITImplPtr<type> GetDITDispatchImpl(int n, type dummy)  { return GetDITImpl(n, dummy); } \
+genfft::FFTDIFImplPtr<type> GetDIFDispatchImpl(int n, type dummy)  { return GetDIFImpl(n, dummy); } \
+genfft::FFTPointwiseImplPtr<type> GetPointwiseDispatchImpl(type dummy)  { return GetPointwiseImpl(dummy); } \
 
 #define DISPATCH_ALL() DISPATCH(float) DISPATCH(double)
 
 #define FORWARD_HORZ(type, from_namespace)\
 genfft::FFTImplPtr<type> GetDispatchImpl(int n, type dummy)  { return from_namespace::GetDispatchImpl(n, dummy); } \
+genfft::FFTImplPtr<type> GetStockhamDispatchImpl(int n, type dummy)  { return from_namespace::GetStockhamDispatchImpl(n, dummy); } \
+genfft::FFTDIFImplPtr<type> GetDIFDispatchImpl(int n, type dummy)  { return from_namespace::GetDIFDispatchImpl(n, dummy); } \
+genfft::FFTPointwiseImplPtr<type> GetPointwiseDispatchImpl(type dummy)  { return from_namespace::GetPointwiseDispatchImpl(dummy); } \
 
 #define FORWARD_VERT(type, from_namespace)\
 genfft::FFTVertImplPtr<type> GetVertDispatchImpl(int n, type dummy)  { return from_namespace::GetVertDispatchImpl(n, dummy); } \
@@ -1,8 +1,17 @@
 std::shared_ptr<impl::FFTBase<float>> GetDispatchImpl(int n, float);
 std::shared_ptr<impl::FFTBase<double>> GetDispatchImpl(int n, double);
 
+std::shared_ptr<impl::FFTBase<float>> GetStockhamDispatchImpl(int n, float);
+std::shared_ptr<impl::FFTBase<double>> GetStockhamDispatchImpl(int n, double);
+
 std::shared_ptr<impl::FFTVertBase<float>> GetVertDispatchImpl(int n, float);
 std::shared_ptr<impl::FFTVertBase<double>> GetVertDispatchImpl(int n, double);
 
 std::shared_ptr<impl::FFTDITBase<float>> GetDITDispatchImpl(int n, float);
 std::shared_ptr<impl::FFTDITBase<double>> GetDITDispatchImpl(int n, double);
+
+std::shared_ptr<impl::FFTDIFBase<float>> GetDIFDispatchImpl(int n, float);
+std::shared_ptr<impl::FFTDIFBase<double>> GetDIFDispatchImpl(int n, double);
+
+std::shared_ptr<impl::FFTPointwiseBase<float>> GetPointwiseDispatchImpl(float);
+std::shared_ptr<impl::FFTPointwiseBase<double>> GetPointwiseDispatchImpl(double);
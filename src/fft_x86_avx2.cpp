@@ -5,11 +5,9 @@
 #include "dispatch_helper.h"
 
 namespace genfft {
-IMPORT_NAMESPACE(impl_AVX_FMA)
 namespace impl_AVX2 {
     #include <genFFT/x86/fft_impl_x86.inl>
 
-    FORWARD(float,  impl_AVX_FMA)
-    FORWARD(double, impl_AVX_FMA)
+    DISPATCH_ALL()
 }
 }
@@ -0,0 +1,21 @@
+#include <cassert>
+#include <immintrin.h>
+#include <genFFT/FFTLevel.h>
+#include <genFFT/generic/fft_impl_generic.h>
+#include "dispatch_helper.h"
+
+namespace genfft {
+IMPORT_NAMESPACE(impl_AVX512)
+namespace impl_AVX512DQ {
+    #include <genFFT/x86/fft_mixed_radix_impl_x86.inl>
+    #include <genFFT/generic/fft_bluestein_impl_generic.inl>
+    #include <genFFT/x86/fft_stockham_impl_x86.inl>
+    #include <genFFT/generic/fft_four_step_impl_generic.inl>
+    #include <genFFT/x86/fft_double_impl_x86.inl>
+    #include <genFFT/x86/fft_dit_impl_x86.inl>
+    #include <genFFT/x86/fft_pointwise_impl_x86.inl>
+
+    DISPATCH(double)
+    FORWARD(float, impl_AVX512)
+}
+}
@@ -1,7 +1,21 @@
 #include <cassert>
+#include <atomic>
+#include <chrono>
+#include <complex>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
 #include <genFFT/FFTLevel.h>
 #include <genFFT/FFTDIT.h>
+#include <genFFT/FFTPointwise.h>
 #include <genFFT/x86/x86_features.h>
+#include <genFFT/x86/fft_x86_dispatch.h>
 
 namespace genfft {
 namespace impl_generic {
@@ -36,12 +50,263 @@ namespace impl_AVX2 {
     #include "fft_get_impl_proto.inl"
 }
 
+namespace impl_AVX512 {
+    #include "fft_get_impl_proto.inl"
+}
+
+namespace impl_AVX512DQ {
+    #include "fft_get_impl_proto.inl"
+}
+
 namespace impl_x86_dispatch {
 
+/// @brief One of the ISA-specific implementation namespaces
+template <typename T>
+struct Backend
+{
+    const char *name;
+    bool (*supported)(const cpu_features &cpu);
+    std::shared_ptr<impl::FFTBase<T>> (*get)(int n, T);
+    std::shared_ptr<impl::FFTBase<T>> (*get_stockham)(int n, T);
+};
+
+#define BACKEND(ns, condition) \
+    { #ns, [](const cpu_features &cpu) -> bool { (void)cpu; return condition; }, \
+      impl_##ns::GetDispatchImpl, impl_##ns::GetStockhamDispatchImpl }
+
+template <typename T>
+const std::vector<Backend<T>> &Backends()
+{
+    static const std::vector<Backend<T>> backends = {
+        BACKEND(AVX512DQ, cpu.AVX512F && cpu.AVX512DQ),
+        BACKEND(AVX512,   cpu.AVX512F),
+        BACKEND(AVX2,     cpu.AVX2),
+        BACKEND(AVX_FMA,  cpu.AVX && cpu.FMA),
+        BACKEND(AVX,      cpu.AVX),
+        BACKEND(SSE41,    cpu.SSE41),
+        BACKEND(SSE3,     cpu.SSE3),
+        BACKEND(SSE2,     cpu.SSE2),
+        BACKEND(SSE,      cpu.SSE),
+        BACKEND(generic,  true),
+    };
+    return backends;
+}
+
+#undef BACKEND
+
+/// @brief Implementation chosen for a 1D FFT of given type and size
+struct WisdomChoice
+{
+    std::string backend;
+    FFTAlgorithm algorithm;
+};
+
+/// @brief Tuned implementation choices, keyed on scalar type name and size
+///
+/// The entries are published as immutable maps, so that looking up a plan takes no lock.
+/// Replaced maps are kept until the end of the program, because a reader may still use them;
+/// there is one per load or autotuned size, and they hold a few bytes per size.
+class Wisdom
+{
+public:
+    static Wisdom &instance()
+    {
+        static Wisdom wisdom;
+        return wisdom;
+    }
+
+    bool find(const char *type, int n, WisdomChoice &choice)
+    {
+        const Map *map = current.load(std::memory_order_acquire);
+        if (!map)
+            return false;
+        auto it = map->find(Key(type, n));
+        if (it == map->end())
+            return false;
+        choice = it->second;
+        return true;
+    }
+
+    void set(const char *type, int n, const WisdomChoice &choice)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        Map map = copy();
+        map[Key(type, n)] = choice;
+        publish(std::move(map));
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        current.store(nullptr, std::memory_order_release);
+    }
+
+    bool load(const char *path)
+    {
+        std::ifstream file(path);
+        std::string line;
+        if (!std::getline(file, line) || line != header)
+            return false;
+        bool ok = true;
+        std::lock_guard<std::mutex> guard(lock);
+        Map map = copy();
+        while (std::getline(file, line))
+        {
+            std::istringstream fields(line);
+            std::string type, backend, algorithm;
+            int n = 0;
+            if (!(fields >> type >> n >> backend >> algorithm) ||
+                (type != "float" && type != "double") ||
+                (algorithm != "Default" && algorithm != "Stockham"))
+            {
+                ok = false;
+                continue;
+            }
+            map[Key(type, n)] = { backend, algorithm == "Stockham" ? FFTAlgorithm::Stockham : FFTAlgorithm::Default };
+        }
+        publish(std::move(map));
+        return ok;
+    }
+
+    bool save(const char *path)
+    {
+        std::ofstream file(path);
+        file << header << "\n";
+        std::lock_guard<std::mutex> guard(lock);
+        for (auto &entry : copy())
+        {
+            file << entry.first.first << " " << entry.first.second << " " << entry.second.backend << " "
+                 << (entry.second.algorithm == FFTAlgorithm::Stockham ? "Stockham" : "Default") << "\n";
+        }
+        return file.good();
+    }
+
+private:
+    typedef std::pair<std::string, int> Key;
+    typedef std::map<Key, WisdomChoice> Map;
+
+    Wisdom() : current(nullptr)
+    {
+        if (const char *path = std::getenv("GENFFT_WISDOM"))
+            load(path);
+    }
+
+    Map copy() const
+    {
+        const Map *map = current.load(std::memory_order_acquire);
+        return map ? *map : Map();
+    }
+
+    void publish(Map &&map)
+    {
+        if (map.empty())
+        {
+            current.store(nullptr, std::memory_order_release);
+            return;
+        }
+        versions.emplace_back(new Map(std::move(map)));
+        current.store(versions.back().get(), std::memory_order_release);
+    }
+
+    static constexpr const char *header = "genFFT wisdom 1";
+
+    std::atomic<const Map *> current;
+    std::vector<std::unique_ptr<const Map>> versions;
+    std::mutex lock;
+};
+
+constexpr const char *Wisdom::header;
+
+inline const char *TypeName(float) { return "float"; }
+inline const char *TypeName(double) { return "double"; }
+
+/// @brief Creates the plan recorded in the wisdom, if there's one for this size and the CPU supports it
+///
+/// A Stockham plan takes naturally ordered input in place, so it can't stand in for the default one,
+/// whose in-place transform expects reordered data (transform_no_scramble, Convolver, etc.).
+/// Callers which need the default algorithm pass it as required; the recorded choice is then
+/// only used if it has this algorithm.
+template <typename T>
+std::shared_ptr<impl::FFTBase<T>> GetWisdomImpl(int n, cpu_features cpu, const FFTAlgorithm *required)
+{
+    WisdomChoice choice;
+    if (!Wisdom::instance().find(TypeName(T()), n, choice))
+        return nullptr;
+    if (required && choice.algorithm != *required)
+        return nullptr;
+    for (auto &backend : Backends<T>())
+    {
+        if (choice.backend == backend.name && backend.supported(cpu))
+            return choice.algorithm == FFTAlgorithm::Stockham ? backend.get_stockham(n, T()) : backend.get(n, T());
+    }
+    return nullptr;
+}
+
+/// @brief Best time, in seconds, of an out-of-place transform
+template <typename T>
+double TimeTransform(impl::FFTBase<T> &plan, T *out, const T *in)
+{
+    using clock = std::chrono::steady_clock;
+    auto start = clock::now();
+    plan.forward(out, in);  // also builds the plan's tables
+    double once = std::chrono::duration<double>(clock::now() - start).count();
+    int reps = once > 1e-3 ? 1 : (int)(1e-3 / (once + 1e-9)) + 1;
+    double best = std::numeric_limits<double>::max();
+    for (int batch = 0; batch < 5; batch++)
+    {
+        start = clock::now();
+        for (int i = 0; i < reps; i++)
+            plan.forward(out, in);
+        double t = std::chrono::duration<double>(clock::now() - start).count() / reps;
+        if (t < best)
+            best = t;
+    }
+    return best;
+}
+
+template <typename T>
+void Autotune(int n, cpu_features cpu)
+{
+    std::vector<std::complex<T>> in(n), out(n);
+    for (int i = 0; i < n; i++)
+        in[i] = { T(i % 7), T(i % 5) };
+
+    WisdomChoice best_choice;
+    double best = std::numeric_limits<double>::max();
+    for (auto &backend : Backends<T>())
+    {
+        if (!backend.supported(cpu))
+            continue;
+        for (FFTAlgorithm algorithm : { FFTAlgorithm::Default, FFTAlgorithm::Stockham })
+        {
+            // Stockham only supports powers of two
+            if (algorithm == FFTAlgorithm::Stockham && (n & (n-1)))
+                continue;
+            auto plan = algorithm == FFTAlgorithm::Stockham ? backend.get_stockham(n, T()) : backend.get(n, T());
+            double t = TimeTransform(*plan, (T*)out.data(), (const T*)in.data());
+            if (t < best)
+            {
+                best = t;
+                best_choice = { backend.name, algorithm };
+            }
+        }
+    }
+    Wisdom::instance().set(TypeName(T()), n, best_choice);
+}
+
 template <typename T>
 std::shared_ptr<impl::FFTBase<T>> GetImpl(int n, cpu_features cpu)
 {
-    if (cpu.AVX2) {
+    const FFTAlgorithm required = FFTAlgorithm::Default;
+    if (auto tuned = GetWisdomImpl<T>(n, cpu, &required))
+        return tuned;
+
+    if (cpu.AVX512F) {
+        if (cpu.AVX512DQ)
+            return impl_AVX512DQ::GetDispatchImpl(n, T());
+        else
+            return impl_AVX512::GetDispatchImpl(n, T());
+    } else if (cpu.AVX2) {
         return impl_AVX2::GetDispatchImpl(n, T());
     } else if (cpu.AVX) {
         if (cpu.FMA)
@@ -53,7 +318,7 @@ std::shared_ptr<impl::FFTBase<T>> GetImpl(int n, cpu_features cpu)
     } else if (cpu.SSE3) {
         return impl_SSE3::GetDispatchImpl(n, T());
     } else if (cpu.SSE2) {
-        return impl_SSE3::GetDispatchImpl(n, T());
+        return impl_SSE2::GetDispatchImpl(n, T());
     } else if (cpu.SSE) {
         return impl_SSE::GetDispatchImpl(n, T());
     } else {
@@ -71,10 +336,78 @@ std::shared_ptr<impl::FFTBase<double>> GetImpl(int n, double)
     return GetImpl<double>(n, GetCPUFeatures());
 }
 
+template <typename T>
+std::shared_ptr<impl::FFTBase<T>> GetTunedImpl(int n, cpu_features cpu)
+{
+    if (auto tuned = GetWisdomImpl<T>(n, cpu, nullptr))
+        return tuned;
+    return GetImpl<T>(n, cpu);
+}
+
+std::shared_ptr<impl::FFTBase<float>> GetTunedImpl(int n, float)
+{
+    return GetTunedImpl<float>(n, GetCPUFeatures());
+}
+
+std::shared_ptr<impl::FFTBase<double>> GetTunedImpl(int n, double)
+{
+    return GetTunedImpl<double>(n, GetCPUFeatures());
+}
+
+template <typename T>
+std::shared_ptr<impl::FFTBase<T>> GetStockhamImpl(int n, cpu_features cpu)
+{
+    if (!(n & (n-1)))
+    {
+        const FFTAlgorithm required = FFTAlgorithm::Stockham;
+        if (auto tuned = GetWisdomImpl<T>(n, cpu, &required))
+            return tuned;
+    }
+
+    if (cpu.AVX512F) {
+        if (cpu.AVX512DQ)
+            return impl_AVX512DQ::GetStockhamDispatchImpl(n, T());
+        else
+            return impl_AVX512::GetStockhamDispatchImpl(n, T());
+    } else if (cpu.AVX2) {
+        return impl_AVX2::GetStockhamDispatchImpl(n, T());
+    } else if (cpu.AVX) {
+        if (cpu.FMA)
+            return impl_AVX_FMA::GetStockhamDispatchImpl(n, T());
+        else
+            return impl_AVX::GetStockhamDispatchImpl(n, T());
+    } else if (cpu.SSE41) {
+        return impl_SSE41::GetStockhamDispatchImpl(n, T());
+    } else if (cpu.SSE3) {
+        return impl_SSE3::GetStockhamDispatchImpl(n, T());
+    } else if (cpu.SSE2) {
+        return impl_SSE2::GetStockhamDispatchImpl(n, T());
+    } else if (cpu.SSE) {
+        return impl_SSE::GetStockhamDispatchImpl(n, T());
+    } else {
+        return impl_generic::GetStockhamDispatchImpl(n, T());
+    }
+}
+
+std::shared_ptr<impl::FFTBase<float>> GetStockhamImpl(int n, float)
+{
+    return GetStockhamImpl<float>(n, GetCPUFeatures());
+}
+
+std::shared_ptr<impl::FFTBase<double>> GetStockhamImpl(int n, double)
+{
+    return GetStockhamImpl<double>(n, GetCPUFeatures());
+}
+
 template <typename T>
 std::shared_ptr<impl::FFTVertBase<T>> GetVertImpl(int n, cpu_features cpu)
 {
-    if (cpu.AVX2) {
+    if (cpu.AVX512F) {
+        if (cpu.AVX512DQ)
+            return impl_AVX512DQ::GetVertDispatchImpl(n, T());
+        else
+            return impl_AVX512::GetVertDispatchImpl(n, T());
+    } else if (cpu.AVX2) {
         return impl_AVX2::GetVertDispatchImpl(n, T());
     } else if (cpu.AVX) {
         if (cpu.FMA)
@@ -86,7 +419,7 @@ std::shared_ptr<impl::FFTVertBase<T>> GetVertImpl(int n, cpu_features cpu)
     } else if (cpu.SSE3) {
         return impl_SSE3::GetVertDispatchImpl(n, T());
     } else if (cpu.SSE2) {
-        return impl_SSE3::GetVertDispatchImpl(n, T());
+        return impl_SSE2::GetVertDispatchImpl(n, T());
     } else if (cpu.SSE) {
         return impl_SSE::GetVertDispatchImpl(n, T());
     } else {
@@ -108,7 +441,12 @@ std::shared_ptr<impl::FFTVertBase<double>> GetVertImpl(int n, double)
 template <typename T>
 std::shared_ptr<impl::FFTDITBase<T>> GetDITImpl(int n, cpu_features cpu)
 {
-    if (cpu.AVX2) {
+    if (cpu.AVX512F) {
+        if (cpu.AVX512DQ)
+            return impl_AVX512DQ::GetDITDispatchImpl(n, T());
+        else
+            return impl_AVX512::GetDITDispatchImpl(n, T());
+    } else if (cpu.AVX2) {
         return impl_AVX2::GetDITDispatchImpl(n, T());
     } else if (cpu.AVX) {
         if (cpu.FMA)
@@ -120,7 +458,7 @@ std::shared_ptr<impl::FFTDITBase<T>> GetDITImpl(int n, cpu_features cpu)
     } else if (cpu.SSE3) {
         return impl_SSE3::GetDITDispatchImpl(n, T());
     } else if (cpu.SSE2) {
-        return impl_SSE3::GetDITDispatchImpl(n, T());
+        return impl_SSE2::GetDITDispatchImpl(n, T());
     } else if (cpu.SSE) {
         return impl_SSE::GetDITDispatchImpl(n, T());
     } else {
@@ -138,6 +476,109 @@ std::shared_ptr<impl::FFTDITBase<double>> GetDITImpl(int n, double)
     return GetDITImpl<double>(n, GetCPUFeatures());
 }
 
+
+template <typename T>
+std::shared_ptr<impl::FFTDIFBase<T>> GetDIFImpl(int n, cpu_features cpu)
+{
+    if (cpu.AVX512F) {
+        if (cpu.AVX512DQ)
+            return impl_AVX512DQ::GetDIFDispatchImpl(n, T());
+        else
+            return impl_AVX512::GetDIFDispatchImpl(n, T());
+    } else if (cpu.AVX2) {
+        return impl_AVX2::GetDIFDispatchImpl(n, T());
+    } else if (cpu.AVX) {
+        if (cpu.FMA)
+            return impl_AVX_FMA::GetDIFDispatchImpl(n, T());
+        else
+            return impl_AVX::GetDIFDispatchImpl(n, T());
+    } else if (cpu.SSE41) {
+        return impl_SSE41::GetDIFDispatchImpl(n, T());
+    } else if (cpu.SSE3) {
+        return impl_SSE3::GetDIFDispatchImpl(n, T());
+    } else if (cpu.SSE2) {
+        return impl_SSE2::GetDIFDispatchImpl(n, T());
+    } else if (cpu.SSE) {
+        return impl_SSE::GetDIFDispatchImpl(n, T());
+    } else {
+        return impl_generic::GetDIFDispatchImpl(n, T());
+    }
+}
+
+std::shared_ptr<impl::FFTDIFBase<float>> GetDIFImpl(int n, float)
+{
+    return GetDIFImpl<float>(n, GetCPUFeatures());
+}
+
+std::shared_ptr<impl::FFTDIFBase<double>> GetDIFImpl(int n, double)
+{
+    return GetDIFImpl<double>(n, GetCPUFeatures());
+}
+
+
+template <typename T>
+std::shared_ptr<impl::FFTPointwiseBase<T>> GetPointwiseImpl(cpu_features cpu)
+{
+    if (cpu.AVX512F) {
+        if (cpu.AVX512DQ)
+            return impl_AVX512DQ::GetPointwiseDispatchImpl(T());
+        else
+            return impl_AVX512::GetPointwiseDispatchImpl(T());
+    } else if (cpu.AVX2) {
+        return impl_AVX2::GetPointwiseDispatchImpl(T());
+    } else if (cpu.AVX) {
+        if (cpu.FMA)
+            return impl_AVX_FMA::GetPointwiseDispatchImpl(T());
+        else
+            return impl_AVX::GetPointwiseDispatchImpl(T());
+    } else if (cpu.SSE41) {
+        return impl_SSE41::GetPointwiseDispatchImpl(T());
+    } else if (cpu.SSE3) {
+        return impl_SSE3::GetPointwiseDispatchImpl(T());
+    } else if (cpu.SSE2) {
+        return impl_SSE2::GetPointwiseDispatchImpl(T());
+    } else if (cpu.SSE) {
+        return impl_SSE::GetPointwiseDispatchImpl(T());
+    } else {
+        return impl_generic::GetPointwiseDispatchImpl(T());
+    }
+}
+
+std::shared_ptr<impl::FFTPointwiseBase<float>> GetPointwiseImpl(float)
+{
+    return GetPointwiseImpl<float>(GetCPUFeatures());
+}
+
+std::shared_ptr<impl::FFTPointwiseBase<double>> GetPointwiseImpl(double)
+{
+    return GetPointwiseImpl<double>(GetCPUFeatures());
+}
+
 }  // impl_x86_dispatch
 
+void AutotuneFFT(int n, float)
+{
+    impl_x86_dispatch::Autotune<float>(n, GetCPUFeatures());
+}
+
+void AutotuneFFT(int n, double)
+{
+    impl_x86_dispatch::Autotune<double>(n, GetCPUFeatures());
+}
+
+bool SaveWisdom(const char *path)
+{
+    return impl_x86_dispatch::Wisdom::instance().save(path);
+}
+
+bool LoadWisdom(const char *path)
+{
+    return impl_x86_dispatch::Wisdom::instance().load(path);
+}
+
+void ForgetWisdom()
+{
+    impl_x86_dispatch::Wisdom::instance().clear();
+}
+
 } // genFFT
@@ -7,8 +7,13 @@
 namespace genfft {
 IMPORT_NAMESPACE(impl_SSE)
 namespace impl_SSE2 {
+    #include <genFFT/x86/fft_mixed_radix_impl_x86.inl>
+    #include <genFFT/generic/fft_bluestein_impl_generic.inl>
+    #include <genFFT/x86/fft_stockham_impl_x86.inl>
+    #include <genFFT/generic/fft_four_step_impl_generic.inl>
     #include <genFFT/x86/fft_double_impl_x86.inl>
     #include <genFFT/x86/fft_dit_impl_x86.inl>
+    #include <genFFT/x86/fft_pointwise_impl_x86.inl>
 
     DISPATCH(double)
     FORWARD(float, impl_SSE)
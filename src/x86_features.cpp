@@ -46,15 +46,29 @@ __get_cpuid_count (uint32_t leaf, uint32_t subleaf,
   return 1;
 }
 
+/// @brief Extended control register 0 - the register states enabled by the OS
+static inline uint64_t xgetbv0()
+{
+    uint32_t eax, edx;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((uint64_t)edx << 32) | eax;
+}
+
 inline cpu_features InitCPUFeatures()
 {
     cpu_features ret = {};
     uint32_t eax = 0, ebx = 0, ecx = 0, edx = 0;
+    bool zmm_state = false;
     eax = 1;
     if (__get_cpuid(1, &eax, &ebx, &ecx, &edx))
     {
+        // opmask, upper halves of ZMM0-15 and ZMM16-31, on top of SSE and AVX state
+        const uint64_t avx512_state = 0xe6;
+        if (ecx & bit_OSXSAVE)
+            zmm_state = (xgetbv0() & avx512_state) == avx512_state;
+
         ret.AVX = ecx & bit_AVX;
-        ret.SSE3 = edx & bit_SSE3;
+        ret.SSE3 = ecx & bit_SSE3;
         ret.SSSE3 = ecx & bit_SSSE3;
         ret.SSE41 = ecx & bit_SSE4_1;
         ret.SSE42 = ecx & bit_SSE4_2;
@@ -66,6 +80,8 @@ inline cpu_features InitCPUFeatures()
     if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
     {
         ret.AVX2 = ebx & bit_AVX2;
+        ret.AVX512F = zmm_state && (ebx & bit_AVX512F);
+        ret.AVX512DQ = zmm_state && (ebx & bit_AVX512DQ);
     }
     return ret;
 }
@@ -0,0 +1,73 @@
+/*
+Copyright 2026 Michal Zientkiewicz
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Code size vs. throughput of compile-time unrolled FFT levels.
+//
+// This benchmark is built twice: genfft_bench_static uses the default
+// GENFFT_MAX_STATIC_LOG2 and genfft_bench_hybrid limits the unrolled levels
+// to 2^10 points, with runtime loops above that. Each run reports the size
+// of its own executable in the binary_size counter.
+
+#include <benchmark/benchmark.h>
+#include <genFFT/fft.h>
+#include <sys/stat.h>
+#include <random>
+#include <complex>
+#include <vector>
+
+static double BinarySize()
+{
+    struct stat st;
+    if (stat("/proc/self/exe", &st) != 0)
+        return 0;
+    return st.st_size;
+}
+
+template <typename T>
+static void FFT_1D(benchmark::State &state)
+{
+    std::mt19937_64 rng;
+    std::uniform_real_distribution<T> dist(-1, 1);
+
+    int n = state.range(0);
+    std::vector<std::complex<T>> in(n), out(n);
+    for (auto &c : in)
+        c = { dist(rng), dist(rng) };
+
+    genfft::FFT<T> fft(n);
+    for (auto _ : state)
+    {
+        fft.template transform<false>(out.data(), in.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+    state.counters["binary_size"] = BinarySize();
+}
+
+BENCHMARK_TEMPLATE(FFT_1D, float)->RangeMultiplier(4)->Range(16, 1<<22);
+BENCHMARK_TEMPLATE(FFT_1D, double)->RangeMultiplier(4)->Range(16, 1<<22);
+
+BENCHMARK_MAIN();
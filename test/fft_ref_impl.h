@@ -124,11 +124,12 @@ void DFT(std::complex<T> *out, const std::complex<T> *in, int n, bool inv)
     for (int i = 0; i < n; i++)
     {
         std::complex<double> c = 0;
-        double a = 0, da = (double)i * den;
-        for (int j = 0; j < n; j++, a += da)
+        for (int j = 0; j < n; j++)
         {
+            // reduce the index product modulo n to keep the angle accurate
+            double a = (double)((long long)i * j % n) * den;
             std::complex<double> t = { std::cos(a), std::sin(a) };
-            c += in[j] * t;
+            c += std::complex<double>(in[j]) * t;
         }
         out[i] = { T(c.real()), T(c.imag()) };
     }
@@ -33,9 +33,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "fft_ref_impl.h"
 
 template <typename T>
-void TestFFT_Pow2(int n)
+void TestFFT_Pow2(int n, genfft::FFTAlgorithm algorithm = genfft::FFTAlgorithm::Default)
 {
-    genfft::FFT<T> fft(n);
+    genfft::FFT<T> fft(n, algorithm);
     std::vector<std::complex<T>> in(n), out(n), invout(n);
     std::vector<std::complex<T>> ref_out(n), ref_inv(n);
     DummyData(in, false);
@@ -57,6 +57,27 @@ void TestFFT_Pow2(int n)
     }
 }
 
+template <typename T>
+void TestFFT_DFT(int n)
+{
+    genfft::FFT<T> fft(n);
+    std::vector<std::complex<T>> in(n), out(n), invout(n), ref_out(n);
+    DummyData(in, false);
+    fft.template transform<false>(out.data(), in.data());
+    fft.template transform<true>(invout.data(), out.data());
+    reference_impl::DFT(ref_out.data(), in.data(), n, false);
+    const T eps = FFT_Eps<T>(n);
+    const double norm = 1.0/n;
+    for (int i = 0; i < n; i++)
+    {
+        std::complex<T> inv_x(std::complex<double>(invout[i]) * norm);
+        ASSERT_NEAR(out[i].real(), ref_out[i].real(), eps) << " i = " << i;
+        ASSERT_NEAR(out[i].imag(), ref_out[i].imag(), eps) << " i = " << i;
+        ASSERT_NEAR(inv_x.real(), in[i].real(), eps) << " i = " << i;
+        ASSERT_NEAR(inv_x.imag(), in[i].imag(), eps) << " i = " << i;
+    }
+}
+
 template <typename T>
 void TestDIT_Pow2(int n, bool in_place)
 {
@@ -105,6 +126,27 @@ void TestRealFFT_Pow2(int n, bool half)
     }
 }
 
+template <typename T>
+void TestRealFFTInverse(int n, bool in_place)
+{
+    genfft::RealFFT<T> fft(n);
+    std::vector<T> in(n);
+    std::vector<std::complex<T>> spectrum(n);
+    DummyData(in);
+    reference_impl::FFT_pow2(spectrum.data(), in.data(), n, false);
+    spectrum.resize(n/2 + 1);
+    // the output buffer is exactly n values - no room for overruns
+    std::vector<T> out(n);
+    T *out_ptr = in_place ? (T*)spectrum.data() : out.data();
+    fft.inverse(out_ptr, spectrum.data());
+    const T eps = FFT_Eps<T>(n);
+    const double norm = 1.0/n;
+    for (int i = 0; i < n; i++)
+    {
+        ASSERT_NEAR(out_ptr[i] * norm, in[i], eps) << " i = " << i;
+    }
+}
+
 template <typename T>
 void TestFFTVert_Pow2(int n, int cols)
 {
@@ -130,4 +172,31 @@ void TestFFTVert_Pow2(int n, int cols)
     }
 }
 
+template <typename T>
+void TestRealFFT2DInverse(int width, int height)
+{
+    genfft::RealFFT2D<T> fft(width, height);
+    genfft::FFT2D<T> ref(width, height);
+    // padded strides - the inverse must not touch the padding
+    const int in_stride = width + 3;
+    const int out_stride = width + 5;
+    std::vector<T> in(height * width);
+    std::vector<std::complex<T>> cin(height * width), spectrum(height * in_stride);
+    std::vector<T> out(height * out_stride, T(-1));
+    DummyData(in);
+    for (int i = 0; i < height * width; i++)
+        cin[i] = in[i];
+    ref.template transform<false>(spectrum.data(), in_stride, cin.data(), width);
+    fft.inverse(out.data(), out_stride, spectrum.data(), in_stride);
+    const T eps = FFT_Eps<T>(width * height);
+    const double norm = 1.0/(width * height);
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+            ASSERT_NEAR(out[y*out_stride + x] * norm, in[y*width + x], eps) << " x = " << x << " y = " << y;
+        for (int x = width; x < out_stride; x++)
+            ASSERT_EQ(out[y*out_stride + x], T(-1)) << " x = " << x << " y = " << y;
+    }
+}
+
 #endif // FFT_TEST_IMPL_H
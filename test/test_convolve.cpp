@@ -0,0 +1,392 @@
+/*
+Copyright 2026 Michal Zientkiewicz
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <genFFT/fft.h>
+#include <gtest/gtest.h>
+#include "test_util.h"
+#include <vector>
+#include <complex>
+#include <atomic>
+#include <cstdlib>
+#include <cerrno>
+
+namespace {
+
+template <class T>
+void FillData(std::vector<T> &v) { DummyData(v); }
+template <class T>
+void FillData(std::vector<std::complex<T>> &v) { DummyData(v, false); }
+
+template <class T>
+void FromComplex(T &out, std::complex<double> x) { out = x.real(); }
+template <class T>
+void FromComplex(std::complex<T> &out, std::complex<double> x) { out = std::complex<T>(x); }
+
+/// @brief Direct O(n*m) convolution or correlation, computed in double precision
+template <class E>
+std::vector<E> DirectConvolution(const std::vector<E> &x, const std::vector<E> &h,
+                                 genfft::ConvolutionMode mode, bool correlation)
+{
+    const int n = x.size(), m = h.size();
+    const bool circular = mode == genfft::ConvolutionMode::Circular;
+    const int out_len = circular ? n : n + m - 1;
+    std::vector<E> out(out_len);
+    for (int j = 0; j < out_len; j++)
+    {
+        std::complex<double> sum = 0;
+        for (int i = 0; i < m; i++)
+        {
+            // signal index paired with kernel[i]
+            int k = correlation ? (circular ? i + j : i + j - (m - 1)) : j - i;
+            if (circular)
+                k = ((k % n) + n) % n;
+            else if (k < 0 || k >= n)
+                continue;
+            std::complex<double> hv = std::complex<double>(h[i]);
+            sum += std::complex<double>(x[k]) * (correlation ? std::conj(hv) : hv);
+        }
+        FromComplex(out[j], sum);
+    }
+    return out;
+}
+
+template <class E>
+void TestConvolver(int n, int m, genfft::ConvolutionMode mode, bool correlation)
+{
+    using T = typename genfft::impl::convolution_scalar<E>::type;
+    std::vector<E> x(n), h(m);
+    FillData(x);
+    FillData(h);
+
+    genfft::Convolver<E> conv(n, m, mode);
+    std::vector<E> out(conv.output_size());
+    if (correlation)
+        conv.correlate(out.data(), x.data(), h.data());
+    else
+        conv.convolve(out.data(), x.data(), h.data());
+    auto ref = DirectConvolution(x, h, mode, correlation);
+    ASSERT_EQ(out.size(), ref.size());
+
+    const double eps = (sizeof(T) == 4 ? 1e-4 : 1e-10) * std::max(1.0, std::sqrt((double)m));
+    for (size_t i = 0; i < ref.size(); i++)
+    {
+        std::complex<double> a = std::complex<double>(out[i]), b = std::complex<double>(ref[i]);
+        ASSERT_NEAR(a.real(), b.real(), eps) << " n = " << n << " m = " << m << " i = " << i;
+        ASSERT_NEAR(a.imag(), b.imag(), eps) << " n = " << n << " m = " << m << " i = " << i;
+    }
+
+    // the cached spectrum is reused
+    conv.apply(out.data(), x.data());
+    for (size_t i = 0; i < ref.size(); i++)
+        ASSERT_NEAR(std::abs(std::complex<double>(out[i]) - std::complex<double>(ref[i])), 0, 2*eps);
+}
+
+template <class E>
+void TestConvolverAll()
+{
+    using genfft::ConvolutionMode;
+    for (bool correlation : { false, true })
+    {
+        for (auto nm : { std::make_pair(1, 1), std::make_pair(100, 7), std::make_pair(1000, 33),
+                         std::make_pair(5, 40), std::make_pair(4096, 1000) })
+            TestConvolver<E>(nm.first, nm.second, ConvolutionMode::Linear, correlation);
+        for (auto nm : { std::make_pair(1, 1), std::make_pair(64, 64), std::make_pair(1000, 33),
+                         std::make_pair(1024, 100), std::make_pair(15, 15), std::make_pair(10, 3) })
+            TestConvolver<E>(nm.first, nm.second, ConvolutionMode::Circular, correlation);
+    }
+}
+
+} // namespace
+
+TEST(Convolver, Float)
+{
+    TestConvolverAll<float>();
+}
+
+TEST(Convolver, Double)
+{
+    TestConvolverAll<double>();
+}
+
+TEST(Convolver, ComplexFloat)
+{
+    TestConvolverAll<std::complex<float>>();
+}
+
+TEST(Convolver, ComplexDouble)
+{
+    TestConvolverAll<std::complex<double>>();
+}
+
+TEST(Convolver, PointwiseMultiply)
+{
+    auto pointwise = genfft::backend::GetPointwiseImpl(float());
+    for (int n : { 1, 3, 8, 13, 100 })
+    {
+        std::vector<std::complex<float>> a(n), b(n), acc(n), ref(n), ref_acc(n);
+        DummyData(a, false);
+        DummyData(b, false);
+        for (int i = 0; i < n; i++)
+        {
+            acc[i] = { 1.0f, -2.0f };
+            ref[i] = a[i] * b[i];
+            ref_acc[i] = acc[i] + ref[i];
+        }
+        pointwise->multiply_add((float*)acc.data(), (const float*)a.data(), (const float*)b.data(), n);
+        pointwise->multiply((float*)a.data(), (const float*)b.data(), n);
+        for (int i = 0; i < n; i++)
+        {
+            EXPECT_NEAR(a[i].real(), ref[i].real(), 1e-6f) << " n = " << n << " i = " << i;
+            EXPECT_NEAR(a[i].imag(), ref[i].imag(), 1e-6f) << " n = " << n << " i = " << i;
+            EXPECT_NEAR(acc[i].real(), ref_acc[i].real(), 1e-6f) << " n = " << n << " i = " << i;
+            EXPECT_NEAR(acc[i].imag(), ref_acc[i].imag(), 1e-6f) << " n = " << n << " i = " << i;
+        }
+    }
+}
+
+namespace {
+
+std::atomic<int> allocations{0};
+// Only the thread under test counts; the other tests' threads allocate freely
+thread_local bool count_allocations = false;
+
+} // namespace
+
+#ifdef __GLIBC__
+// Every allocation - including operator new and the aligned buffers of the library - ends up
+// in one of these functions; count the calls and forward them to glibc.
+extern "C" {
+
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *p, size_t size);
+void *__libc_memalign(size_t alignment, size_t size);
+
+void *malloc(size_t size)
+{
+    if (count_allocations)
+        allocations++;
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size)
+{
+    if (count_allocations)
+        allocations++;
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *p, size_t size)
+{
+    if (count_allocations)
+        allocations++;
+    return __libc_realloc(p, size);
+}
+
+void *memalign(size_t alignment, size_t size)
+{
+    if (count_allocations)
+        allocations++;
+    return __libc_memalign(alignment, size);
+}
+
+void *aligned_alloc(size_t alignment, size_t size)
+{
+    if (count_allocations)
+        allocations++;
+    return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void **p, size_t alignment, size_t size)
+{
+    if (count_allocations)
+        allocations++;
+    *p = __libc_memalign(alignment, size);
+    return *p ? 0 : ENOMEM;
+}
+
+} // extern "C"
+#endif
+
+template <class E>
+void TestFIRFilter(int taps, int block_size, const std::vector<int> &chunks)
+{
+    using T = typename genfft::impl::convolution_scalar<E>::type;
+    const int len = 20000;
+    std::vector<E> x(len), h(taps), out(len);
+    FillData(x);
+    FillData(h);
+
+    genfft::FIRFilter<E> fir(h.data(), taps, block_size);
+    ASSERT_GE(fir.block_size(), block_size);
+    ASSERT_EQ(fir.latency(), fir.block_size());
+
+    allocations = 0;
+    count_allocations = true;
+    for (int pos = 0, c = 0; pos < len; c++)
+    {
+        int k = std::min(chunks[c % chunks.size()], len - pos);
+        fir.process(out.data() + pos, x.data() + pos, k);
+        pos += k;
+    }
+    count_allocations = false;
+    EXPECT_EQ(allocations, 0) << "process must not allocate";
+
+    const int delay = fir.latency();
+    const double eps = (sizeof(T) == 4 ? 1e-4 : 1e-10) * std::sqrt((double)taps);
+    for (int t = 0; t < len; t++)
+    {
+        std::complex<double> ref = 0;
+        for (int i = 0; i < taps; i++)
+        {
+            int k = t - delay - i;
+            if (k >= 0)
+                ref += std::complex<double>(x[k]) * std::complex<double>(h[i]);
+        }
+        std::complex<double> y = std::complex<double>(out[t]);
+        ASSERT_NEAR(y.real(), ref.real(), eps) << " taps = " << taps << " t = " << t;
+        ASSERT_NEAR(y.imag(), ref.imag(), eps) << " taps = " << taps << " t = " << t;
+    }
+}
+
+TEST(FIRFilter, Streaming)
+{
+    TestFIRFilter<float>(1, 0, { 100 });
+    TestFIRFilter<float>(1024, 0, { 1, 7, 1000, 333, 4096 });
+    TestFIRFilter<float>(1000, 24, { 64, 17 });
+    TestFIRFilter<double>(3000, 0, { 5000, 1 });
+    TestFIRFilter<std::complex<float>>(257, 0, { 10, 100, 1000 });
+    TestFIRFilter<std::complex<double>>(100, 1000, { 999 });
+}
+
+template <class E>
+void TestLongFIRFilter(int taps)
+{
+    using T = typename genfft::impl::convolution_scalar<E>::type;
+    std::vector<E> h(taps);
+    FillData(h);
+    genfft::FIRFilter<E> fir(h.data(), taps);
+    const int delay = fir.latency();
+    const int len = 2*fir.block_size() + taps;
+    std::vector<E> x(len), out(len);
+    FillData(x);
+
+    allocations = 0;
+    count_allocations = true;
+    for (int pos = 0; pos < len; pos += 100000)
+        fir.process(out.data() + pos, x.data() + pos, std::min(100000, len - pos));
+    count_allocations = false;
+    EXPECT_EQ(allocations, 0) << "process must not allocate";
+
+    // a direct reference for all the samples would take too long - check a few around the block boundaries
+    const double eps = (sizeof(T) == 4 ? 1e-4 : 1e-10) * std::sqrt((double)taps);
+    for (int b = 1; b <= 2; b++)
+    {
+        for (int t = b*delay - 5; t < b*delay + 5; t++)
+        {
+            std::complex<double> ref = 0;
+            for (int i = 0; i < taps; i++)
+            {
+                int k = t - delay - i;
+                if (k >= 0)
+                    ref += std::complex<double>(x[k]) * std::complex<double>(h[i]);
+            }
+            std::complex<double> y = std::complex<double>(out[t]);
+            ASSERT_NEAR(y.real(), ref.real(), eps) << " taps = " << taps << " t = " << t;
+            ASSERT_NEAR(y.imag(), ref.imag(), eps) << " taps = " << taps << " t = " << t;
+        }
+    }
+}
+
+TEST(FIRFilter, LongFilter)
+{
+    TestLongFIRFilter<float>(65536);
+    TestLongFIRFilter<std::complex<float>>(65536);
+}
+
+TEST(FIRFilter, BlockSize)
+{
+    for (int taps : { 1, 16, 1024, 4096, 65536 })
+    {
+        int n = genfft::FIRFilter<float>::optimal_transform_size(taps);
+        EXPECT_EQ(n & (n-1), 0);
+        EXPECT_GE(n, 2*taps);
+        EXPECT_LE(n, 64*taps < 64 ? 64 : 64*taps);
+    }
+}
+
+template <class E>
+void TestPartitionedConvolver(int ir_len, int block_size, const std::vector<int> &chunks)
+{
+    using T = typename genfft::impl::convolution_scalar<E>::type;
+    const int len = 8000;
+    std::vector<E> x(len), h(ir_len), out(len);
+    FillData(x);
+    FillData(h);
+
+    genfft::PartitionedConvolver<E> conv(h.data(), ir_len, block_size);
+    ASSERT_EQ(conv.partitions(), (ir_len + block_size - 1) / block_size);
+    ASSERT_EQ(conv.latency(), block_size);
+
+    allocations = 0;
+    count_allocations = true;
+    for (int pos = 0, c = 0; pos < len; c++)
+    {
+        int k = std::min(chunks[c % chunks.size()], len - pos);
+        conv.process(out.data() + pos, x.data() + pos, k);
+        pos += k;
+    }
+    count_allocations = false;
+    EXPECT_EQ(allocations, 0) << "process must not allocate";
+
+    const double eps = (sizeof(T) == 4 ? 1e-4 : 1e-10) * std::sqrt((double)ir_len);
+    for (int t = 0; t < len; t++)
+    {
+        std::complex<double> ref = 0;
+        for (int i = 0; i < ir_len; i++)
+        {
+            int k = t - block_size - i;
+            if (k >= 0)
+                ref += std::complex<double>(x[k]) * std::complex<double>(h[i]);
+        }
+        std::complex<double> y = std::complex<double>(out[t]);
+        ASSERT_NEAR(y.real(), ref.real(), eps) << " ir = " << ir_len << " t = " << t;
+        ASSERT_NEAR(y.imag(), ref.imag(), eps) << " ir = " << ir_len << " t = " << t;
+    }
+}
+
+TEST(PartitionedConvolver, Streaming)
+{
+    TestPartitionedConvolver<float>(1, 64, { 64 });
+    TestPartitionedConvolver<float>(3000, 64, { 64 });
+    TestPartitionedConvolver<float>(1000, 64, { 1, 100, 37, 500 });
+    TestPartitionedConvolver<float>(2048, 256, { 128 });
+    TestPartitionedConvolver<double>(777, 32, { 32, 7 });
+    TestPartitionedConvolver<float>(10, 1, { 3 });
+    TestPartitionedConvolver<double>(33, 2, { 5 });
+    TestPartitionedConvolver<std::complex<float>>(500, 64, { 64 });
+    TestPartitionedConvolver<std::complex<double>>(129, 128, { 1000 });
+}
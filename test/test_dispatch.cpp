@@ -28,7 +28,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <gtest/gtest.h>
 #include <vector>
 #include <complex>
+#include <typeinfo>
 #include <random>
+#include <fstream>
+#include <string>
+#include <cstdio>
 #include "test_util.h"
 #include "fft_test_impl.h"
 
@@ -54,6 +58,18 @@ TEST_P(FFT_test_pow2, Pow2_double)
     TestFFT_Pow2<double>(n);
 }
 
+TEST_P(FFT_test_pow2, Stockham_float)
+{
+    int n = GetParam();
+    TestFFT_Pow2<float>(n, genfft::FFTAlgorithm::Stockham);
+}
+
+TEST_P(FFT_test_pow2, Stockham_double)
+{
+    int n = GetParam();
+    TestFFT_Pow2<double>(n, genfft::FFTAlgorithm::Stockham);
+}
+
 
 auto FFT_Pow2_Sizes = ::testing::Values(2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192,
     1<<14, 1<<15, 1<<16, 1<<17, 1<<18, 1<<19, 1<<20);
@@ -64,6 +80,147 @@ INSTANTIATE_TEST_CASE_P(
     FFT_Pow2_Sizes
 );
 
+///////////////////////////////////////////////////////////////
+// Mixed-radix FFT test
+
+class FFT_test_mixed_radix : public testing::TestWithParam<int>
+{
+};
+
+TEST_P(FFT_test_mixed_radix, MixedRadix_float)
+{
+    int n = GetParam();
+    TestFFT_DFT<float>(n);
+}
+
+TEST_P(FFT_test_mixed_radix, MixedRadix_double)
+{
+    int n = GetParam();
+    TestFFT_DFT<double>(n);
+}
+
+auto FFT_MixedRadix_Sizes = ::testing::Values(3, 5, 6, 7, 9, 10, 12, 14, 15, 21, 24, 25, 45, 49, 96,
+    105, 343, 384, 480, 1000, 1920, 3000, 4410);
+
+INSTANTIATE_TEST_CASE_P(
+    FFT_MixedRadix,
+    FFT_test_mixed_radix,
+    FFT_MixedRadix_Sizes
+);
+
+///////////////////////////////////////////////////////////////
+// Bluestein FFT test
+
+class FFT_test_bluestein : public testing::TestWithParam<int>
+{
+};
+
+TEST_P(FFT_test_bluestein, Bluestein_float)
+{
+    int n = GetParam();
+    TestFFT_DFT<float>(n);
+}
+
+TEST_P(FFT_test_bluestein, Bluestein_double)
+{
+    int n = GetParam();
+    TestFFT_DFT<double>(n);
+}
+
+auto FFT_Bluestein_Sizes = ::testing::Values(11, 13, 17, 22, 33, 97, 101, 127, 257, 1009, 1031, 2002, 4099);
+
+INSTANTIATE_TEST_CASE_P(
+    FFT_Bluestein,
+    FFT_test_bluestein,
+    FFT_Bluestein_Sizes
+);
+
+///////////////////////////////////////////////////////////////
+// Wisdom test
+
+TEST(Wisdom, AutotuneSaveLoad)
+{
+    genfft::AutotuneFFT(1024, float());
+    genfft::AutotuneFFT(1000, double());
+    std::string path = testing::TempDir() + "genfft_wisdom.txt";
+    ASSERT_TRUE(genfft::SaveWisdom(path.c_str()));
+    genfft::ForgetWisdom();
+    ASSERT_TRUE(genfft::LoadWisdom(path.c_str()));
+
+    std::ifstream file(path);
+    std::string header, type, backend, algorithm;
+    int n = 0;
+    std::getline(file, header);
+    EXPECT_EQ(header, "genFFT wisdom 1");
+    ASSERT_TRUE(bool(file >> type >> n >> backend >> algorithm));
+    EXPECT_EQ(type, "double");
+    EXPECT_EQ(n, 1000);
+    EXPECT_EQ(algorithm, "Default");
+    ASSERT_TRUE(bool(file >> type >> n >> backend >> algorithm));
+    EXPECT_EQ(type, "float");
+    EXPECT_EQ(n, 1024);
+    EXPECT_FALSE(bool(file >> type));
+
+    // plans follow the loaded choices
+    TestFFT_Pow2<float>(1024);
+    TestFFT_DFT<double>(1000);
+
+    // A Stockham entry must not turn the default plan into one that takes natural-order input
+    const int m = 64;
+    file.close();
+    {
+        std::ofstream forced(path);
+        forced << "genFFT wisdom 1\nfloat " << m << " generic Stockham\n";
+    }
+    genfft::ForgetWisdom();
+    ASSERT_TRUE(genfft::LoadWisdom(path.c_str()));
+
+    std::vector<std::complex<float>> in(m), data(m), ref(m);
+    DummyData(in, false);
+    reference_impl::FFT_pow2(ref.data(), in.data(), m, false);
+
+    genfft::FFT<float> fft(m);
+    genfft::scramble(data.data(), in.data(), m);
+    fft.transform_no_scramble<false>(data.data());
+    const float eps = FFT_Eps<float>(m);
+    for (int i = 0; i < m; i++)
+    {
+        ASSERT_NEAR(data[i].real(), ref[i].real(), eps) << " i = " << i;
+        ASSERT_NEAR(data[i].imag(), ref[i].imag(), eps) << " i = " << i;
+    }
+    // the inverse, also without reordering, gets m times the input back
+    genfft::scramble(ref.data(), data.data(), m);
+    fft.transform_no_scramble<true>(ref.data());
+    for (int i = 0; i < m; i++)
+    {
+        ASSERT_NEAR(ref[i].real() / m, in[i].real(), eps) << " i = " << i;
+        ASSERT_NEAR(ref[i].imag() / m, in[i].imag(), eps) << " i = " << i;
+    }
+
+    // the transforms of naturally ordered data use the recorded algorithm
+    TestFFT_Pow2<float>(m);
+    // the Stockham algorithm is still available on request
+    TestFFT_Pow2<float>(m, genfft::FFTAlgorithm::Stockham);
+
+    // the plans come from the recorded backend
+    {
+        std::ofstream forced(path);
+        forced << "genFFT wisdom 1\nfloat " << m << " generic Default\ndouble " << m << " generic Stockham\n";
+    }
+    genfft::ForgetWisdom();
+    ASSERT_TRUE(genfft::LoadWisdom(path.c_str()));
+    auto generic_plan = genfft::impl_generic::GetImpl(m, float());
+    EXPECT_EQ(typeid(*genfft::backend::GetImpl(m, float())), typeid(*generic_plan));
+    EXPECT_EQ(typeid(*genfft::backend::GetTunedImpl(m, float())), typeid(*generic_plan));
+    EXPECT_EQ(typeid(*genfft::backend::GetTunedImpl(m, double())), typeid(genfft::impl_generic::FFTStockham<double>));
+    // ...except for the ordered plan, which can't be a Stockham one
+    EXPECT_EQ(genfft::backend::GetImpl(m, double())->input_order(), nullptr);
+
+    genfft::ForgetWisdom();
+    std::remove(path.c_str());
+    EXPECT_FALSE(genfft::LoadWisdom(path.c_str()));
+}
+
 ///////////////////////////////////////////////////////////////
 // Vertical FFT test
 
@@ -26,10 +26,14 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <genFFT/fft.h>
 #include "test_util.h"
+#include "fft_ref_impl.h"
 #include <gtest/gtest.h>
 #include <vector>
 #include <complex>
 #include <random>
+#include <atomic>
+#include <thread>
+#include <memory>
 
 namespace {
 
@@ -56,8 +60,523 @@ TEST_P(FFT_float_test, InverseIdentity)
     }
 }
 
+class FFT_float_stockham_test : public testing::TestWithParam<int>
+{
+};
+
+TEST_P(FFT_float_stockham_test, InPlaceInverseIdentity)
+{
+    int n = GetParam();
+    genfft::FFT<float> fft(n, genfft::FFTAlgorithm::Stockham);
+    std::vector<std::complex<float>> in(n), data(n);
+    DummyData(in, false);
+    data = in;
+    fft.transform_no_scramble<false>(data.data());
+    fft.transform_no_scramble<true>(data.data());
+    const float eps = 1e-4f;
+    const float norm = 1.0f/n;
+    for (int i = 0; i < n; i++)
+    {
+        std::complex<float> x = data[i] * norm;
+        ASSERT_NEAR(in[i].real(), x.real(), eps);
+        ASSERT_NEAR(in[i].imag(), x.imag(), eps);
+    }
+}
+
+template <typename T>
+class FFT_four_step_test : public testing::Test
+{
+};
+
+using FFT_four_step_types = ::testing::Types<float, double>;
+TYPED_TEST_CASE(FFT_four_step_test, FFT_four_step_types);
+
+// Four-step is only selected for large sizes; test the engine directly on small ones
+TYPED_TEST(FFT_four_step_test, CompareWithReference)
+{
+    using T = TypeParam;
+    using namespace genfft::impl_native;
+    for (int n = 4; n <= 8192; n *= 2)
+    {
+        int cols = four_step_cols(n);
+        FFTFourStep<T> fft(n, GetImpl(cols, T()), GetVertImpl(n / cols, T()));
+        std::vector<std::complex<T>> in(n), out(n), inplace(n), ref(n);
+        DummyData(in, false);
+        const T eps = FFT_Eps<T>(n);
+        for (bool inv : { false, true })
+        {
+            reference_impl::FFT_pow2(ref.data(), in.data(), n, inv);
+            genfft::scramble(inplace.data(), in.data(), n);
+            if (inv)
+            {
+                fft.inverse((T*)out.data(), (const T*)in.data());
+                fft.inverse((T*)inplace.data());
+            }
+            else
+            {
+                fft.forward((T*)out.data(), (const T*)in.data());
+                fft.forward((T*)inplace.data());
+            }
+            for (int i = 0; i < n; i++)
+            {
+                ASSERT_NEAR(out[i].real(), ref[i].real(), eps) << " n = " << n << " i = " << i;
+                ASSERT_NEAR(out[i].imag(), ref[i].imag(), eps) << " n = " << n << " i = " << i;
+                ASSERT_NEAR(inplace[i].real(), ref[i].real(), eps) << " n = " << n << " i = " << i;
+                ASSERT_NEAR(inplace[i].imag(), ref[i].imag(), eps) << " n = " << n << " i = " << i;
+            }
+        }
+    }
+}
+
+// The scratch memory is per thread, so one plan can be used by several threads at once
+TYPED_TEST(FFT_four_step_test, SharedPlanThreads)
+{
+    using T = TypeParam;
+    using namespace genfft::impl_native;
+    const int n = 8192;
+    int cols = four_step_cols(n);
+    FFTFourStep<T> fft(n, GetImpl(cols, T()), GetVertImpl(n / cols, T()));
+    std::vector<std::complex<T>> in(n), ref(n);
+    DummyData(in, false);
+    reference_impl::FFT_pow2(ref.data(), in.data(), n, false);
+    const T eps = FFT_Eps<T>(n);
+
+    std::atomic<int> errors(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&]()
+        {
+            std::vector<std::complex<T>> out(n), inplace(n);
+            for (int rep = 0; rep < 20; rep++)
+            {
+                genfft::scramble(inplace.data(), in.data(), n);
+                fft.forward((T*)out.data(), (const T*)in.data());
+                fft.forward((T*)inplace.data());
+                for (int i = 0; i < n; i++)
+                {
+                    if (std::abs(out[i] - ref[i]) > 2*eps || std::abs(inplace[i] - ref[i]) > 2*eps)
+                    {
+                        errors++;
+                        break;
+                    }
+                }
+            }
+        });
+    }
+    for (auto &t : threads)
+        t.join();
+    EXPECT_EQ(errors, 0);
+}
+
+struct RegistryTestPlan
+{
+    explicit RegistryTestPlan(int size) : size(size) { live++; }
+    virtual ~RegistryTestPlan() { live--; }
+    int size;
+    static std::atomic<int> live;
+};
+
+std::atomic<int> RegistryTestPlan::live(0);
+
+TEST(PlanRegistry, ConcurrentLookup)
+{
+    using Registry = genfft::impl::PlanRegistry<RegistryTestPlan>;
+    const int num_threads = 8, num_sizes = 16;
+    std::vector<std::shared_ptr<RegistryTestPlan>> plans(num_threads * num_sizes);
+    std::atomic<int> created(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; t++)
+    {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < num_sizes; i++)
+            {
+                int size = 1 << ((i + t) % num_sizes);
+                plans[t*num_sizes + i] = Registry::instance().get<RegistryTestPlan>(size, 0, [&, size]() {
+                    created++;
+                    return new RegistryTestPlan(size);
+                });
+            }
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    EXPECT_EQ(created, num_sizes);
+    EXPECT_EQ(RegistryTestPlan::live, num_sizes);
+    for (auto &plan : plans)
+    {
+        auto same = Registry::instance().get<RegistryTestPlan>(plan->size, 0, []() { return nullptr; });
+        EXPECT_EQ(same, plan);
+    }
+
+    plans.clear();
+    EXPECT_EQ(RegistryTestPlan::live, 0);
+    auto rebuilt = Registry::instance().get<RegistryTestPlan>(1, 0, []() { return new RegistryTestPlan(1); });
+    EXPECT_EQ(RegistryTestPlan::live, 1);
+}
+
+TEST(PlanRegistry, Retention)
+{
+    using Registry = genfft::impl::PlanRegistry<RegistryTestPlan>;
+    int created = 0;
+    auto get = [&](int size) {
+        return Registry::instance().get<RegistryTestPlan>(size, 100, [&]() {
+            created++;
+            return new RegistryTestPlan(size);
+        });
+    };
+    ASSERT_EQ(RegistryTestPlan::live, 0);
+
+    genfft::SetPlanRetention(genfft::PlanRetention::Pin);
+    get(3);
+    get(5);
+    EXPECT_EQ(RegistryTestPlan::live, 2);
+    get(3);
+    EXPECT_EQ(created, 2);
+
+    genfft::SetPlanRetention(genfft::PlanRetention::LRU, 250);
+    EXPECT_EQ(RegistryTestPlan::live, 2);
+    get(3);  // 5 is now the least recently used
+    get(7);
+    EXPECT_EQ(RegistryTestPlan::live, 2);
+    EXPECT_EQ(created, 3);
+    get(3);
+    EXPECT_EQ(created, 3);
+    get(5);
+    EXPECT_EQ(created, 4);
+
+    genfft::SetPlanRetention(genfft::PlanRetention::Weak);
+    EXPECT_EQ(RegistryTestPlan::live, 0);
+}
+
+TEST(PlanRegistry, Prewarm)
+{
+    genfft::SetPlanRetention(genfft::PlanRetention::Pin);
+    genfft::PrewarmPlans<float>({ 240, 4096 });
+    genfft::impl::FFTBase<float> *plan = genfft::backend::GetImpl(4096, float()).get();
+    EXPECT_EQ(plan, genfft::backend::GetImpl(4096, float()).get());
+    genfft::SetPlanRetention(genfft::PlanRetention::Weak);
+}
+
+TEST(PlanRegistry, SharedLevels)
+{
+    auto a = genfft::backend::GetImpl(1024, float());
+    auto b = genfft::backend::GetImpl(1024, float());
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, genfft::backend::GetImpl(512, float()));
+    auto vert = genfft::backend::GetVertImpl(256, double());
+    EXPECT_EQ(vert, genfft::backend::GetVertImpl(256, double()));
+    auto dit = genfft::backend::GetDITImpl(512, float());
+    EXPECT_EQ(dit, genfft::backend::GetDITImpl(512, float()));
+    // runtime-sized levels are registry plans as well
+    using Level = genfft::impl::FFTLevel<-1, float, genfft::impl_native::FFTFloat<-1>>;
+    auto leaf = genfft::impl_native::GetImpl(16, float());
+    EXPECT_EQ(Level::GetInstance(1024, leaf), Level::GetInstance(1024, leaf));
+}
+
+TEST(TwiddleTable, SharedAcrossLevels)
+{
+    using genfft::TwiddleTable;
+    genfft::SharedTwiddle<1024, float> a;
+    genfft::SharedTwiddle<-1, float> b(1024);
+    EXPECT_EQ(a.t, b.t);
+    EXPECT_EQ(a.t, TwiddleTable<float>::radix2(1024).get());
+    EXPECT_NE(a.t, TwiddleTable<float>::radix2(512).get());
+    for (int k = 0; k < 512; k++)
+    {
+        EXPECT_NEAR(a[2*k],   std::cos(2*M_PI*k/1024), 1e-7);
+        EXPECT_NEAR(a[2*k+1], -std::sin(2*M_PI*k/1024), 1e-7);
+    }
+    genfft::SharedTwiddle4<-1, double> w(64);
+    for (int k = 0; k < 16; k++)
+    {
+        EXPECT_NEAR(w.w3()[2*k],   std::cos(2*M_PI*3*k/64), 1e-15);
+        EXPECT_NEAR(w.w3()[2*k+1], -std::sin(2*M_PI*3*k/64), 1e-15);
+    }
+
+    // radix-4 levels take W^k and W^2k from the radix-2 tables, shared with the levels of other sizes
+    genfft::SharedTwiddle4<1024, float> r4;
+    genfft::SharedTwiddle4<-1, float> r4_half(512);
+    EXPECT_EQ(r4.w1(), a.t);
+    EXPECT_EQ(r4.w2(), TwiddleTable<float>::radix2(512).get());
+    EXPECT_EQ(r4.w2(), r4_half.w1());
+
+    // so do the Stockham passes
+    genfft::FFT<float> stockham(1 << 12, genfft::FFTAlgorithm::Stockham);
+    EXPECT_GT(TwiddleTable<float>::radix4_w3(1 << 12).use_count(), 1);
+    EXPECT_GT(TwiddleTable<float>::radix4_w3(1 << 10).use_count(), 1);
+}
+
+TEST(TwiddleTable, ReleasedWithLastPlan)
+{
+    const int n = 1 << 18;
+    std::vector<std::complex<float>> in(n), out(n);
+    std::weak_ptr<const float> table;
+    auto use_plan = [&]()
+    {
+        genfft::FFT<float> fft(n);
+        fft.transform<false>(out.data(), in.data());  // builds the twiddle factors
+        table = genfft::TwiddleTable<float>::radix4_w3(n);
+        EXPECT_FALSE(table.expired());
+    };
+
+    use_plan();
+    EXPECT_TRUE(table.expired());
+
+    // the tables of retained plans stay, until the plans are evicted
+    genfft::SetPlanRetention(genfft::PlanRetention::LRU, 64 << 20);
+    use_plan();
+    EXPECT_FALSE(table.expired());
+    genfft::SetPlanRetention(genfft::PlanRetention::LRU, 0);
+    EXPECT_TRUE(table.expired());
+    genfft::SetPlanRetention(genfft::PlanRetention::Weak);
+}
+
+TEST(TwiddleTable, WholeCircle)
+{
+    const int N = 4096;
+    genfft::SharedTwiddle4<N, double> w;
+    const double *tables[3] = { w.w1(), w.w2(), w.w3() };
+    for (int m = 1; m <= 3; m++)
+    {
+        for (int k = 0; k < N/4; k++)
+        {
+            EXPECT_NEAR(tables[m-1][2*k],   std::cos(2*M_PI*m*k/N), 1e-15);
+            EXPECT_NEAR(tables[m-1][2*k+1], -std::sin(2*M_PI*m*k/N), 1e-15);
+        }
+    }
+}
+
+TEST(TwiddleTable, BakedAndComputed)
+{
+    typedef genfft::impl::SineTable<> Baked;
+    for (int i = 0; i <= Baked::size/4; i++)
+        EXPECT_NEAR(Baked::values[i], std::sin(2*M_PI*i/Baked::size), 2e-16);
+
+    // larger than the baked table - evaluated at run time
+    const int N = Baked::size * 4;
+    auto table = genfft::TwiddleTable<double>::radix2(N);
+    const double *t = table.get();
+    for (int k = 0; k < N/2; k += 7)
+    {
+        EXPECT_NEAR(t[2*k],   std::cos(2*M_PI*k/N), 1e-15);
+        EXPECT_NEAR(t[2*k+1], -std::sin(2*M_PI*k/N), 1e-15);
+    }
+}
+
+TEST(Scramble, Blocked)
+{
+    using genfft::reverse_bits;
+    // sizes below, at and above the blocked permutation's threshold
+    for (int log2n : { 6, 10, 13, 16 })
+    {
+        const int n = 1 << log2n;
+        std::vector<int> in(3*n), out(3*n);
+        for (int i = 0; i < 3*n; i++)
+            in[i] = i;
+
+        for (int stride : { 1, 2 })
+        {
+            std::fill(out.begin(), out.end(), -1);
+            genfft::scramble(out.data(), in.data(), n, stride);
+            for (int i = 0; i < n; i++)
+                ASSERT_EQ(out[reverse_bits(i, log2n)*stride], i) << " n = " << n << " stride = " << stride;
+        }
+
+        for (int cols : { 1, 3 })
+        {
+            std::fill(out.begin(), out.end(), -1);
+            genfft::scramble_rows(out.data(), cols, in.data(), cols, n, cols);
+            for (int i = 0; i < n; i++)
+                for (int j = 0; j < cols; j++)
+                    ASSERT_EQ(out[reverse_bits(i, log2n)*cols + j], i*cols + j) << " n = " << n << " cols = " << cols;
+        }
+    }
+}
+
+TEST(Scramble, InPlace)
+{
+    for (int log2n : { 0, 3, 10, 13, 14, 17 })
+    {
+        const int n = 1 << log2n;
+        std::vector<int> in(n), ref(n);
+        for (int i = 0; i < n; i++)
+            in[i] = i;
+        genfft::scramble(ref.data(), in.data(), n);
+        genfft::scramble_inplace(in.data(), n);
+        ASSERT_EQ(in, ref) << " n = " << n;
+    }
+}
+
+TEST(FFT_inplace_test, MatchesOutOfPlace)
+{
+    for (auto algorithm : { genfft::FFTAlgorithm::Default, genfft::FFTAlgorithm::Stockham })
+    {
+        for (int n : { 1, 16, 1000, 1009, 1024, 1 << 14 })
+        {
+            if (algorithm == genfft::FFTAlgorithm::Stockham && (n < 2 || (n & (n-1))))
+                continue;
+            genfft::FFT<float> fft(n, algorithm);
+            std::vector<std::complex<float>> in(n), out(n);
+            DummyData(in, false);
+            for (bool inv : { false, true })
+            {
+                std::vector<std::complex<float>> data = in;
+                if (inv)
+                {
+                    fft.transform<true>(out.data(), in.data());
+                    fft.transform_inplace<true>(data.data());
+                }
+                else
+                {
+                    fft.transform<false>(out.data(), in.data());
+                    fft.transform_inplace<false>(data.data());
+                }
+                for (int i = 0; i < n; i++)
+                {
+                    ASSERT_EQ(data[i], out[i]) << " n = " << n << " i = " << i;
+                }
+            }
+        }
+    }
+}
+
+template <typename T, typename Level>
+void TestRuntimeLevel(int n, int leaf_size)
+{
+    using namespace genfft::impl_native;
+    auto fft = genfft::impl::FFTLevel<-1, T, Level>::GetInstance(n, GetImpl(leaf_size, T()));
+    ASSERT_EQ(fft->size(), n);
+    std::vector<std::complex<T>> in(n), out(n), ref(n);
+    DummyData(in, false);
+    const T eps = FFT_Eps<T>(n);
+    for (bool inv : { false, true })
+    {
+        reference_impl::FFT_pow2(ref.data(), in.data(), n, inv);
+        if (inv)
+            fft->inverse((T*)out.data(), (const T*)in.data());
+        else
+            fft->forward((T*)out.data(), (const T*)in.data());
+        for (int i = 0; i < n; i++)
+        {
+            ASSERT_NEAR(out[i].real(), ref[i].real(), eps) << " n = " << n << " i = " << i;
+            ASSERT_NEAR(out[i].imag(), ref[i].imag(), eps) << " n = " << n << " i = " << i;
+        }
+    }
+}
+
+// Runtime-sized levels are only selected above the largest static size; test them with small leaves
+TEST(FFT_runtime_level_test, CompareWithReference)
+{
+    using namespace genfft;
+    for (int n : { 64, 256, 1024, 4096 })
+    {
+        TestRuntimeLevel<float, impl_native::FFTFloat<-1>>(n, 16);
+        TestRuntimeLevel<double, impl_native::FFTDouble<-1>>(n, 16);
+    }
+    for (int n : { 16, 32, 1024, 2048 })
+    {
+        TestRuntimeLevel<float, impl_generic::FFTGeneric<-1, float>>(n, 8);
+        TestRuntimeLevel<double, impl_generic::FFTGeneric<-1, double>>(n, 8);
+    }
+}
+
+template <typename T>
+void TestDIF(const std::shared_ptr<genfft::impl::FFTDIFBase<T>> &fft, int n)
+{
+    ASSERT_EQ(fft->size(), n);
+    std::vector<std::complex<T>> in(n), out(n), ref(n), ref_rev(n);
+    DummyData(in, false);
+    const T eps = FFT_Eps<T>(n);
+    for (bool inv : { false, true })
+    {
+        reference_impl::FFT_pow2(ref.data(), in.data(), n, inv);
+        genfft::scramble(ref_rev.data(), ref.data(), n);
+        out = in;
+        if (inv)
+            fft->inverse((T*)out.data());
+        else
+            fft->forward((T*)out.data());
+        for (int i = 0; i < n; i++)
+        {
+            ASSERT_NEAR(out[i].real(), ref_rev[i].real(), eps) << " n = " << n << " i = " << i;
+            ASSERT_NEAR(out[i].imag(), ref_rev[i].imag(), eps) << " n = " << n << " i = " << i;
+        }
+    }
+}
+
+TEST(FFT_DIF_test, CompareWithReference)
+{
+    using namespace genfft;
+    for (int n : { 1, 2, 4, 8, 16, 32, 64, 128, 1024, 4096, 1 << 15 })
+    {
+        TestDIF(impl_native::GetDIFImpl(n, float()), n);
+        TestDIF(impl_native::GetDIFImpl(n, double()), n);
+        TestDIF(impl_generic::GetDIFImpl(n, float()), n);
+        TestDIF(backend::GetDIFImpl(n, double()), n);
+    }
+    // runtime-sized levels, with small leaves
+    for (int n : { 64, 256, 1024, 4096 })
+    {
+        TestDIF<float>(impl::FFTDIFLevel<-1, float, impl_native::FFTDIFFloat<-1>>::GetInstance(
+            n, impl_native::GetDIFImpl(16, float())), n);
+        TestDIF<double>(impl::FFTDIFLevel<-1, double, impl_native::FFTDIFDouble<-1>>::GetInstance(
+            n, impl_native::GetDIFImpl(16, double())), n);
+    }
+    for (int n : { 16, 32, 1024, 2048 })
+    {
+        TestDIF<float>(impl::FFTDIFLevel<-1, float, impl_generic::FFTDIFGeneric<-1, float>>::GetInstance(
+            n, impl_generic::GetDIFImpl(8, float())), n);
+    }
+}
+
+TEST(FFT_DIF_test, NonPow2Size)
+{
+    using namespace genfft;
+    for (int n : { 0, 3, 12, 100, 1000 })
+    {
+        EXPECT_EQ(impl_native::GetDIFImpl(n, float()), nullptr) << " n = " << n;
+        EXPECT_EQ(impl_native::GetDIFImpl(n, double()), nullptr) << " n = " << n;
+        EXPECT_EQ(impl_generic::GetDIFImpl(n, float()), nullptr) << " n = " << n;
+        EXPECT_FALSE(FFTDIF<float>(n)) << " n = " << n;
+        EXPECT_FALSE(FFTDIF<double>(n)) << " n = " << n;
+    }
+}
+
+TEST(FFT_DIF_test, ScrambleFreeConvolution)
+{
+    for (int n : { 16, 256, 4096 })
+    {
+        genfft::FFTDIF<float> dif(n);
+        genfft::FFT<float> fft(n);
+        std::vector<std::complex<float>> a(n), b(n), ref(n);
+        DummyData(a, false);
+        for (int i = 0; i < n; i++)
+            b[i] = std::complex<float>(i < 3 ? 1.0f / (i + 1) : 0, 0);
+        // circular convolution computed directly; the inverse transform is not normalized
+        for (int i = 0; i < n; i++)
+        {
+            std::complex<double> sum = 0;
+            for (int j = 0; j < n; j++)
+                sum += std::complex<double>(a[j]) * std::complex<double>(b[(i - j + n) % n]);
+            ref[i] = std::complex<float>(sum * (double)n);
+        }
+        dif.transform<false>(a.data());
+        dif.transform<false>(b.data());
+        for (int i = 0; i < n; i++)
+            a[i] *= b[i];
+        fft.transform_no_scramble<true>(a.data());
+        for (int i = 0; i < n; i++)
+        {
+            ASSERT_NEAR(a[i].real(), ref[i].real(), 1e-4f * n) << " n = " << n << " i = " << i;
+            ASSERT_NEAR(a[i].imag(), ref[i].imag(), 1e-4f * n) << " n = " << n << " i = " << i;
+        }
+    }
+}
+
 auto FFT_Sizes = ::testing::Values(2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192,
-    1<<14, 1<<15, 1<<16, 1<<17, 1<<18, 1<<19, 1<<20, 1<<21, 1<<22);
+    1<<14, 1<<15, 1<<16, 1<<17, 1<<18, 1<<19, 1<<20, 1<<21, 1<<22, 1<<24);
 
 INSTANTIATE_TEST_CASE_P(
     InverseIdentity,
@@ -65,4 +584,22 @@ INSTANTIATE_TEST_CASE_P(
     FFT_Sizes
 );
 
+INSTANTIATE_TEST_CASE_P(
+    InverseIdentityMixedRadix,
+    FFT_float_test,
+    ::testing::Values(3, 6, 15, 48, 360, 1440, 3 * 5 * 7 * 256, 3 * 3 * 5 * 5 * 7 * 7 * 64, 81 * 4096)
+);
+
+INSTANTIATE_TEST_CASE_P(
+    InverseIdentityBluestein,
+    FFT_float_test,
+    ::testing::Values(11, 13, 101, 1021, 65537, 1000003)
+);
+
+INSTANTIATE_TEST_CASE_P(
+    StockhamInPlace,
+    FFT_float_stockham_test,
+    FFT_Sizes
+);
+
 } // namespace
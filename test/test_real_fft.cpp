@@ -55,6 +55,22 @@ TEST_P(FFT_real_test, Pow2_double)
     TestRealFFT_Pow2<double>(n, half);
 }
 
+TEST_P(FFT_real_test, Inverse_float)
+{
+    int n;
+    bool in_place;
+    std::tie(n, in_place) = GetParam();
+    TestRealFFTInverse<float>(n, in_place);
+}
+
+TEST_P(FFT_real_test, Inverse_double)
+{
+    int n;
+    bool in_place;
+    std::tie(n, in_place) = GetParam();
+    TestRealFFTInverse<double>(n, in_place);
+}
+
 auto FFTReal_SizeHalf = ::testing::Combine(
     ::testing::Values(2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192,
                       1<<14, 1<<15, 1<<16, 1<<17, 1<<18, 1<<19, 1<<20, 1<<21, 1<<22),
@@ -66,4 +82,30 @@ INSTANTIATE_TEST_CASE_P(
     FFTReal_SizeHalf
 );
 
+class FFT_real2D_test : public testing::TestWithParam<std::tuple<int, int>>
+{
+};
+
+TEST_P(FFT_real2D_test, Inverse_float)
+{
+    int width, height;
+    std::tie(width, height) = GetParam();
+    TestRealFFT2DInverse<float>(width, height);
+}
+
+TEST_P(FFT_real2D_test, Inverse_double)
+{
+    int width, height;
+    std::tie(width, height) = GetParam();
+    TestRealFFT2DInverse<double>(width, height);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    RealFFT2D,
+    FFT_real2D_test,
+    ::testing::Combine(
+        ::testing::Values(4, 8, 16, 64, 256, 1024),
+        ::testing::Values(1, 2, 4, 32, 128, 512))
+);
+
 } // namespace
@@ -40,17 +40,19 @@ extern cpu_features x86_cpu_features;
 } // genfft
 
 static cpu_features feature_params[] = {
-    { 0, 0, 0, 0, 0, 0, 0, 0, 0, },
-    { 1, 0, 0, 0, 0, 0, 0, 0, 0, },
-    { 1, 1, 0, 0, 0, 0, 0, 0, 0, },
-    { 1, 1, 1, 0, 0, 0, 0, 0, 0, },
-    { 1, 1, 1, 1, 0, 0, 0, 0, 0, },
-    { 1, 1, 1, 1, 1, 0, 0, 0, 0, },
-    { 1, 1, 1, 1, 1, 1, 0, 0, 0, },
-    { 1, 1, 1, 1, 1, 1, 0, 0, 1, },
-    { 1, 1, 1, 1, 1, 1, 1, 0, 0, },
-    { 1, 1, 1, 1, 1, 1, 1, 0, 1, },
-    { 1, 1, 1, 1, 1, 1, 1, 1, 1, },
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, },
+    { 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, },
+    { 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, },
+    { 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, },
+    { 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, },
+    { 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, },
+    { 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, },
+    { 1, 1, 1, 1, 1, 1, 0, 0, 1, 0, 0, },
+    { 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, },
+    { 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 0, },
+    { 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, },
+    { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, },
+    { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, },
 };
 
 std::ostream &operator<<(std::ostream &os, cpu_features features)
@@ -66,6 +68,8 @@ std::ostream &operator<<(std::ostream &os, cpu_features features)
     PRINT_FEATURE(AVX)
     PRINT_FEATURE(AVX2)
     PRINT_FEATURE(FMA)
+    PRINT_FEATURE(AVX512F)
+    PRINT_FEATURE(AVX512DQ)
     return os;
 }
 
@@ -115,6 +119,78 @@ TEST(TestArchs, Pow2_double)
     genfft::x86_cpu_features = old_features;
 }
 
+TEST(TestArchs, Stockham_float)
+{
+    cpu_features old_features = genfft::x86_cpu_features;
+    for (cpu_features f : feature_params)
+    {
+        if (!FeaturesSupported(f, old_features))
+            continue;
+        genfft::x86_cpu_features = f;
+        std::cout << "Testing CPU features:\n" << f;
+        for (int n = 1; n <= 256; n *= 2)
+        {
+            std::cout << "Testing FFT size: " << n << "\n";
+            TestFFT_Pow2<float>(n, genfft::FFTAlgorithm::Stockham);
+        }
+    }
+    genfft::x86_cpu_features = old_features;
+}
+
+TEST(TestArchs, Stockham_double)
+{
+    cpu_features old_features = genfft::x86_cpu_features;
+    for (cpu_features f : feature_params)
+    {
+        if (!FeaturesSupported(f, old_features))
+            continue;
+        genfft::x86_cpu_features = f;
+        std::cout << "Testing CPU features:\n" << f;
+        for (int n = 1; n <= 256; n *= 2)
+        {
+            std::cout << "Testing FFT size: " << n << "\n";
+            TestFFT_Pow2<double>(n, genfft::FFTAlgorithm::Stockham);
+        }
+    }
+    genfft::x86_cpu_features = old_features;
+}
+
+TEST(TestArchs, MixedRadix_float)
+{
+    cpu_features old_features = genfft::x86_cpu_features;
+    for (cpu_features f : feature_params)
+    {
+        if (!FeaturesSupported(f, old_features))
+            continue;
+        genfft::x86_cpu_features = f;
+        std::cout << "Testing CPU features:\n" << f;
+        for (int n : { 3, 5, 7, 6, 12, 20, 28, 45, 60, 105, 210, 240, 11, 13, 37, 101 })
+        {
+            std::cout << "Testing FFT size: " << n << "\n";
+            TestFFT_DFT<float>(n);
+        }
+    }
+    genfft::x86_cpu_features = old_features;
+}
+
+TEST(TestArchs, MixedRadix_double)
+{
+    cpu_features old_features = genfft::x86_cpu_features;
+    for (cpu_features f : feature_params)
+    {
+        if (!FeaturesSupported(f, old_features))
+            continue;
+        genfft::x86_cpu_features = f;
+        std::cout << "Testing CPU features:\n" << f;
+        for (int n : { 3, 5, 7, 6, 12, 20, 28, 45, 60, 105, 210, 240, 11, 13, 37, 101 })
+        {
+            std::cout << "Testing FFT size: " << n << "\n";
+            TestFFT_DFT<double>(n);
+        }
+    }
+    genfft::x86_cpu_features = old_features;
+}
+
 TEST(TestArchs, VertPow2_float)
 {
     cpu_features old_features = genfft::x86_cpu_features;